@@ -0,0 +1,61 @@
+#include "font_pages.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "font.h"
+
+#define PAGES 256
+#define PAGE_SIZE 256
+
+size_t print_font_pages(const char *name, const int *codepoints,
+                        const int *glyphs, size_t length) {
+  int first[PAGES];
+  int last[PAGES];
+
+  for (size_t page = 0; page < PAGES; ++page) {
+    first[page] = PAGE_SIZE;
+    last[page] = -1;
+  }
+
+  for (size_t i = 0; i < length; ++i) {
+    int page = codepoints[i] / PAGE_SIZE;
+    int low = codepoints[i] % PAGE_SIZE;
+
+    if (low < first[page])
+      first[page] = low;
+    if (low > last[page])
+      last[page] = low;
+  }
+
+  size_t offset = 0;
+
+  printf("static const struct bitmap_font_page %s_font_pages[%d] = {\r\n",
+         name, PAGES);
+  for (size_t page = 0; page < PAGES; ++page) {
+    if (last[page] < first[page]) {
+      printf("  {0, 0xff, 0x00},\r\n");
+    } else {
+      printf("  {%zu, 0x%02x, 0x%02x},\r\n", offset, first[page], last[page]);
+      offset += last[page] - first[page] + 1;
+    }
+  }
+  printf("};\r\n\r\n");
+
+  printf("static const uint16_t %s_font_page_glyphs[%zu] = {\r\n", name,
+         offset);
+  size_t i = 0;
+  for (size_t page = 0; page < PAGES; ++page) {
+    for (int low = first[page]; low <= last[page]; ++low) {
+      int glyph = BITMAP_FONT_NO_GLYPH;
+
+      if (i < length && codepoints[i] == page * PAGE_SIZE + low)
+        glyph = glyphs[i++];
+
+      printf("  0x%04x,\r\n", glyph);
+    }
+  }
+  printf("};\r\n\r\n");
+
+  return PAGES * sizeof(struct bitmap_font_page) + offset * sizeof(uint16_t);
+}
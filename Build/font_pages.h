@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stddef.h>
+
+// Prints the paged codepoint index of a font as name_font_pages and
+// name_font_page_glyphs, codepoints must be sorted and below 0x10000.
+// Returns the size of the index in bytes.
+size_t print_font_pages(const char *name, const int *codepoints,
+                        const int *glyphs, size_t length);
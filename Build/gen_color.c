@@ -0,0 +1,61 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "rgb.h"
+
+// 4 bits per channel keep the table at 4 KB. 5 bits take 32 KB and pick the
+// exact nearest entry only slightly more often, since the color cube levels
+// are at least 40 apart
+#define COLOR_TABLE_BITS 4
+#define COLOR_TABLE_LEVELS (1 << COLOR_TABLE_BITS)
+
+// System colors 0-15 are skipped, they vary between terminals
+#define FIRST_COLOR 16
+
+static int level_value(int level) {
+  int step = 0x100 / COLOR_TABLE_LEVELS;
+  return level * step + step / 2;
+}
+
+static uint8_t nearest_color(int red, int green, int blue) {
+  uint8_t nearest = FIRST_COLOR;
+  long nearest_distance = -1;
+
+  for (size_t i = FIRST_COLOR; i < RGB_TABLE_SIZE; ++i) {
+    rgb_t rgb = rgb_table[i];
+    long red_delta = red - (int)((rgb >> 16) & 0xff);
+    long green_delta = green - (int)((rgb >> 8) & 0xff);
+    long blue_delta = blue - (int)(rgb & 0xff);
+    long distance = red_delta * red_delta + green_delta * green_delta +
+                    blue_delta * blue_delta;
+
+    if (nearest_distance == -1 || distance < nearest_distance) {
+      nearest = i;
+      nearest_distance = distance;
+    }
+  }
+
+  return nearest;
+}
+
+int main() {
+  size_t size = COLOR_TABLE_LEVELS * COLOR_TABLE_LEVELS * COLOR_TABLE_LEVELS;
+
+  printf("#define COLOR_TABLE_BITS %d\r\n\r\n", COLOR_TABLE_BITS);
+  printf("/* nearest rgb_table index by red, green and blue levels */\r\n\r\n");
+  printf("static const uint8_t color_table[%zu] = {\r\n", size);
+  for (size_t i = 0; i < size; ++i) {
+    int red = i / (COLOR_TABLE_LEVELS * COLOR_TABLE_LEVELS);
+    int green = (i / COLOR_TABLE_LEVELS) % COLOR_TABLE_LEVELS;
+    int blue = i % COLOR_TABLE_LEVELS;
+
+    if (i % 16 == 0)
+      printf("  ");
+    printf("%3d,%s",
+           nearest_color(level_value(red), level_value(green),
+                         level_value(blue)),
+           i % 16 == 15 ? "\r\n" : " ");
+  }
+  printf("};\r\n");
+  return 0;
+}
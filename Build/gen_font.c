@@ -0,0 +1,387 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "font.h"
+#include "font_pages.h"
+
+#define MAX_CODEPOINTS 0x10000
+#define MAX_WIDTH 8
+#define MAX_HEIGHT 32
+#define MAX_LINE 256
+
+#define REPLACEMENT_CODEPOINT 0xfffd
+
+#define PSF1_MAGIC 0x0436
+#define PSF1_MODE512 0x01
+#define PSF1_MODEHASTAB 0x02
+#define PSF1_MODESEQ 0x04
+#define PSF1_SEPARATOR 0xffff
+#define PSF1_STARTSEQ 0xfffe
+
+#define PSF2_MAGIC 0x864ab572
+#define PSF2_HAS_UNICODE_TABLE 0x01
+#define PSF2_SEPARATOR 0xff
+#define PSF2_STARTSEQ 0xfe
+
+struct font {
+  int width;
+  int height;
+  size_t glyphs_length;
+  size_t glyphs_capacity;
+  uint8_t *data;
+  int glyphs[MAX_CODEPOINTS];
+};
+
+static uint8_t reverse_byte(uint8_t byte) {
+  uint8_t reversed_byte = 0;
+
+  for (size_t i = 0; i < 8; ++i)
+    if (byte & (1 << i))
+      reversed_byte |= 1 << (7 - i);
+
+  return reversed_byte;
+}
+
+static uint8_t *add_glyph(struct font *font) {
+  if (font->glyphs_length == font->glyphs_capacity) {
+    font->glyphs_capacity =
+        font->glyphs_capacity ? font->glyphs_capacity * 2 : 256;
+    font->data = realloc(font->data, font->glyphs_capacity * font->height);
+  }
+
+  uint8_t *rows = font->data + font->glyphs_length++ * font->height;
+  memset(rows, 0, font->height);
+  return rows;
+}
+
+static void map_codepoint(struct font *font, uint32_t codepoint, int glyph) {
+  if (codepoint < MAX_CODEPOINTS && font->glyphs[codepoint] == -1)
+    font->glyphs[codepoint] = glyph;
+}
+
+static bool set_size(struct font *font, int width, int height) {
+  if (width < 1 || width > MAX_WIDTH || height < 1 || height > MAX_HEIGHT) {
+    fprintf(stderr, "unsupported glyph size %dx%d\n", width, height);
+    return false;
+  }
+
+  font->width = width;
+  font->height = height;
+  return true;
+}
+
+static bool load_bdf(FILE *file, struct font *font) {
+  char line[MAX_LINE];
+  int font_width = 0, font_height = 0, font_x = 0, font_y = 0;
+  long encoding = -1;
+  int width = 0, height = 0, x = 0, y = 0;
+
+  while (fgets(line, sizeof(line), file)) {
+    if (sscanf(line, "FONTBOUNDINGBOX %d %d %d %d", &font_width, &font_height,
+               &font_x, &font_y) == 4) {
+      if (!set_size(font, font_width, font_height))
+        return false;
+    } else if (sscanf(line, "ENCODING %ld", &encoding) == 1) {
+    } else if (sscanf(line, "BBX %d %d %d %d", &width, &height, &x, &y) == 4) {
+    } else if (strncmp(line, "BITMAP", 6) == 0) {
+      if (!font->height) {
+        fprintf(stderr, "BITMAP before FONTBOUNDINGBOX\n");
+        return false;
+      }
+
+      uint8_t *rows = add_glyph(font);
+      int top = (font_height + font_y) - (y + height);
+
+      for (int row = 0; row < height && fgets(line, sizeof(line), file);
+           ++row) {
+        size_t digits = strspn(line, "0123456789abcdefABCDEF");
+        unsigned long bits = strtoul(line, NULL, 16);
+
+        for (int col = 0; col < width && col < (int)digits * 4; ++col) {
+          int font_row = top + row;
+          int font_col = x - font_x + col;
+
+          if (font_row < 0 || font_row >= font->height || font_col < 0 ||
+              font_col >= font->width)
+            continue;
+
+          if (bits & (1ul << (digits * 4 - 1 - col)))
+            rows[font_row] |= 1 << font_col;
+        }
+      }
+
+      if (encoding >= 0)
+        map_codepoint(font, encoding, font->glyphs_length - 1);
+
+      encoding = -1;
+    }
+  }
+
+  return font->glyphs_length;
+}
+
+static bool load_psf_glyphs(FILE *file, struct font *font, size_t length,
+                            size_t charsize) {
+  size_t row_bytes = (font->width + 7) / 8;
+
+  if (charsize != row_bytes * font->height) {
+    fprintf(stderr, "unexpected glyph size %zu\n", charsize);
+    return false;
+  }
+
+  for (size_t i = 0; i < length; ++i) {
+    uint8_t *rows = add_glyph(font);
+
+    for (int row = 0; row < font->height; ++row) {
+      int byte = fgetc(file);
+
+      if (byte == EOF)
+        return false;
+
+      rows[row] = reverse_byte(byte);
+    }
+  }
+
+  return true;
+}
+
+static void map_glyph_positions(struct font *font) {
+  for (size_t i = 0; i < font->glyphs_length; ++i)
+    map_codepoint(font, i, i);
+}
+
+static bool load_psf1(FILE *file, struct font *font) {
+  int mode = fgetc(file);
+  int charsize = fgetc(file);
+
+  if (mode == EOF || charsize == EOF || !set_size(font, 8, charsize))
+    return false;
+
+  size_t length = mode & PSF1_MODE512 ? 512 : 256;
+
+  if (!load_psf_glyphs(file, font, length, charsize))
+    return false;
+
+  if (!(mode & (PSF1_MODEHASTAB | PSF1_MODESEQ))) {
+    map_glyph_positions(font);
+    return true;
+  }
+
+  for (size_t glyph = 0; glyph < length; ++glyph) {
+    bool sequence = false;
+
+    for (;;) {
+      int low = fgetc(file);
+      int high = fgetc(file);
+
+      if (low == EOF || high == EOF)
+        return false;
+
+      uint16_t value = low | (high << 8);
+
+      if (value == PSF1_SEPARATOR)
+        break;
+      else if (value == PSF1_STARTSEQ)
+        sequence = true;
+      else if (!sequence)
+        map_codepoint(font, value, glyph);
+    }
+  }
+
+  return true;
+}
+
+static uint32_t read_uint32(FILE *file) {
+  uint32_t value = 0;
+
+  for (size_t i = 0; i < 4; ++i)
+    value |= (uint32_t)(fgetc(file) & 0xff) << (i * 8);
+
+  return value;
+}
+
+static bool load_psf2(FILE *file, struct font *font) {
+  read_uint32(file);
+  uint32_t header_size = read_uint32(file);
+  uint32_t flags = read_uint32(file);
+  uint32_t length = read_uint32(file);
+  uint32_t charsize = read_uint32(file);
+  uint32_t height = read_uint32(file);
+  uint32_t width = read_uint32(file);
+
+  if (!set_size(font, width, height))
+    return false;
+
+  fseek(file, header_size, SEEK_SET);
+
+  if (!load_psf_glyphs(file, font, length, charsize))
+    return false;
+
+  if (!(flags & PSF2_HAS_UNICODE_TABLE)) {
+    map_glyph_positions(font);
+    return true;
+  }
+
+  for (size_t glyph = 0; glyph < length; ++glyph) {
+    bool sequence = false;
+
+    for (;;) {
+      int byte = fgetc(file);
+
+      if (byte == EOF)
+        return false;
+
+      if (byte == PSF2_SEPARATOR)
+        break;
+      else if (byte == PSF2_STARTSEQ) {
+        sequence = true;
+        continue;
+      }
+
+      uint32_t codepoint;
+      size_t continuation;
+
+      if (byte < 0x80) {
+        codepoint = byte;
+        continuation = 0;
+      } else if (byte >= 0xf0) {
+        codepoint = byte & 0x07;
+        continuation = 3;
+      } else if (byte >= 0xe0) {
+        codepoint = byte & 0x0f;
+        continuation = 2;
+      } else {
+        codepoint = byte & 0x1f;
+        continuation = 1;
+      }
+
+      for (size_t i = 0; i < continuation; ++i)
+        codepoint = (codepoint << 6) | (fgetc(file) & 0x3f);
+
+      if (!sequence)
+        map_codepoint(font, codepoint, glyph);
+    }
+  }
+
+  return true;
+}
+
+static bool load_font(const char *path, struct font *font) {
+  FILE *file = fopen(path, "rb");
+
+  if (!file) {
+    perror(path);
+    return false;
+  }
+
+  for (size_t i = 0; i < MAX_CODEPOINTS; ++i)
+    font->glyphs[i] = -1;
+
+  uint32_t magic = read_uint32(file);
+  bool loaded;
+
+  if ((magic & 0xffff) == PSF1_MAGIC) {
+    fseek(file, 2, SEEK_SET);
+    loaded = load_psf1(file, font);
+  } else if (magic == PSF2_MAGIC) {
+    loaded = load_psf2(file, font);
+  } else {
+    fseek(file, 0, SEEK_SET);
+    loaded = load_bdf(file, font);
+  }
+
+  fclose(file);
+
+  if (!loaded)
+    fprintf(stderr, "%s: cannot load font\n", path);
+
+  return loaded;
+}
+
+static int find_unique_glyph(const struct font *font, const uint8_t *data,
+                             size_t length, const uint8_t *rows) {
+  for (size_t i = 0; i < length; ++i)
+    if (memcmp(data + i * font->height, rows, font->height) == 0)
+      return i;
+
+  return -1;
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    fprintf(stderr, "usage: %s NAME FONT.bdf|FONT.psf\n", argv[0]);
+    return 1;
+  }
+
+  const char *name = argv[1];
+  static struct font font;
+
+  if (!load_font(argv[2], &font))
+    return 1;
+
+  static int codepoints[MAX_CODEPOINTS];
+  static int glyphs[MAX_CODEPOINTS];
+  size_t length = 0;
+
+  uint8_t *data = malloc(font.glyphs_length * font.height);
+  size_t unique_length = 0;
+
+  // Loaded glyphs are deduplicated and numbered in codepoint order,
+  // glyphs no codepoint maps to are dropped
+  for (size_t codepoint = 0; codepoint < MAX_CODEPOINTS; ++codepoint) {
+    if (font.glyphs[codepoint] == -1)
+      continue;
+
+    const uint8_t *rows = font.data + font.glyphs[codepoint] * font.height;
+    int glyph = find_unique_glyph(&font, data, unique_length, rows);
+
+    if (glyph == -1) {
+      if (unique_length == BITMAP_FONT_NO_GLYPH) {
+        fprintf(stderr, "too many glyphs\n");
+        return 1;
+      }
+
+      memcpy(data + unique_length * font.height, rows, font.height);
+      glyph = unique_length++;
+    }
+
+    codepoints[length] = codepoint;
+    glyphs[length] = glyph;
+    length++;
+  }
+
+  if (font.glyphs[REPLACEMENT_CODEPOINT] == -1)
+    fprintf(stderr, "%s: warning, no replacement glyph\n", name);
+
+  size_t data_size = unique_length * font.height;
+
+  printf("/* generated by gen_font from %s */\r\n\r\n", argv[2]);
+  printf("/* row data, little-endian (smallest bit on left) */\r\n\r\n");
+  printf("const int %s_font_glyphs = %zu;\r\n", name, unique_length);
+  printf("const int %s_font_width = %d;\r\n", name, font.width);
+  printf("const int %s_font_height = %d;\r\n\r\n", name, font.height);
+  printf("const uint8_t %s_font_data[%zu] = {\r\n", name, data_size);
+  for (size_t i = 0; i < data_size; ++i) {
+    if (i % 16 == 0)
+      printf("  ");
+    printf("0x%02x,%s", data[i], i % 16 == 15 ? "\r\n" : " ");
+  }
+  if (data_size % 16)
+    printf("\r\n");
+  printf("};\r\n\r\n");
+
+  size_t index_size = print_font_pages(name, codepoints, glyphs, length);
+
+  fprintf(stderr,
+          "%s: %zu codepoints, %zu glyphs (%zu unique), %zu bytes of bitmaps, "
+          "%zu bytes of index, %zu bytes of flash\n",
+          name, length, font.glyphs_length, unique_length, data_size,
+          index_size, data_size + index_size);
+
+  free(data);
+  free(font.data);
+  return 0;
+}
@@ -0,0 +1,24 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "font.h"
+#include "font_pages.h"
+
+#include "FontProblems/bold.h"
+#include "FontProblems/normal.h"
+
+static void print_index(const char *name, const int *codepoints,
+                        const int *codepoints_map, size_t length) {
+  size_t size = print_font_pages(name, codepoints, codepoints_map, length);
+
+  fprintf(stderr, "%s: %zu bytes of index (was %zu)\n", name, size,
+          length * 2 * sizeof(int));
+}
+
+int main() {
+  print_index("normal", normal_font_codepoints, normal_font_codepoints_map,
+              sizeof(normal_font_codepoints) / sizeof(int));
+  print_index("bold", bold_font_codepoints, bold_font_codepoints_map,
+              sizeof(bold_font_codepoints) / sizeof(int));
+  return 0;
+}
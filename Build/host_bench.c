@@ -0,0 +1,827 @@
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "rgb.h"
+#include "screen.h"
+#include "terminal.h"
+#include "terminal_internal.h"
+
+#include "FontProblems/bold.h"
+#include "FontProblems/font_index.h"
+#include "FontProblems/normal.h"
+
+// Throughput benchmark of the terminal core built for Linux. Workloads are
+// replayed the way the main loop drains the UART ring, time is split between
+// parsing, cell updates and rasterization into a virtual framebuffer
+
+#define FONT_WIDTH 8
+#define FONT_HEIGHT 16
+
+#define MAX_COLS 80
+#define MAX_ROWS 24
+#define TAB_STOPS_SIZE (MAX_COLS / 8)
+
+#define TRANSMIT_BUFFER_SIZE 256
+
+// Same as the UART ring and chunk sizes in main.c
+#define RECEIVE_BUFFER_SIZE (1024 * 16)
+#define RECEIVE_CHUNK_SIZE 64
+
+#define CAPTURE_SIZE (1024 * 1024)
+#define DEFAULT_REPEAT 4
+
+#define UART_FRAME_BITS 10
+
+static const struct bitmap_font normal_bitmap_font = {
+    .height = FONT_HEIGHT,
+    .width = FONT_WIDTH,
+    .data = normal_font_data,
+    .pages = normal_font_pages,
+    .page_glyphs = normal_font_page_glyphs,
+};
+
+static const struct bitmap_font bold_bitmap_font = {
+    .height = FONT_HEIGHT,
+    .width = FONT_WIDTH,
+    .data = bold_font_data,
+    .pages = bold_font_pages,
+    .page_glyphs = bold_font_page_glyphs,
+};
+
+static uint8_t screen_buffer[FONT_WIDTH * FONT_HEIGHT * MAX_COLS * MAX_ROWS];
+static uint8_t cursor_buffers[2][FONT_WIDTH * FONT_HEIGHT];
+
+static struct screen screen = {
+    .format = {.rows = MAX_ROWS, .cols = MAX_COLS},
+    .char_width = FONT_WIDTH,
+    .char_height = FONT_HEIGHT,
+    .buffer = screen_buffer,
+    .blitter = &software_blitter,
+    .normal_bitmap_font = &normal_bitmap_font,
+    .bold_bitmap_font = &bold_bitmap_font,
+    .cursor_buffers = {cursor_buffers[0], cursor_buffers[1]},
+};
+
+static struct visual_cell default_cells[MAX_ROWS * MAX_COLS];
+static struct visual_cell alt_cells[MAX_ROWS * MAX_COLS];
+static uint8_t tab_stops[TAB_STOPS_SIZE];
+static character_t transmit_buffer[TRANSMIT_BUFFER_SIZE];
+
+static struct terminal_config terminal_config = {
+    .format_rows = FORMAT_24_ROWS,
+
+    .charset = CHARSET_UTF8,
+    .keyboard_compatibility = KEYBOARD_COMPATIBILITY_PC,
+    .receive_c1_mode = C1_MODE_8BIT,
+    .transmit_c1_mode = C1_MODE_7BIT,
+
+    .auto_wrap_mode = true,
+    .screen_mode = false,
+
+    .send_receive_mode = true,
+
+    .new_line_mode = false,
+    .cursor_key_mode = false,
+    .auto_repeat_mode = true,
+    .ansi_mode = true,
+    .backspace_mode = false,
+    .application_keypad_mode = false,
+    .keyboard_layout = KEYBOARD_LAYOUT_US,
+
+    .start_up = START_UP_NONE,
+
+    .flow_control = false,
+};
+
+enum bench_phase {
+  PHASE_PARSE,
+  PHASE_CELLS,
+  PHASE_RASTER,
+  PHASE_MAX,
+};
+
+static bool profiling = false;
+static enum bench_phase phase = PHASE_PARSE;
+static uint64_t phase_start;
+static uint64_t phase_time[PHASE_MAX];
+static uint64_t characters;
+
+static uint64_t get_time() {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000 + time.tv_nsec;
+}
+
+// Time up to now is charged to the current phase, the previous phase is
+// returned for the caller to switch back to
+static enum bench_phase enter_phase(enum bench_phase next_phase) {
+  enum bench_phase previous_phase = phase;
+
+  if (profiling) {
+    uint64_t time = get_time();
+
+    phase_time[phase] += time - phase_start;
+    phase_start = time;
+  }
+
+  phase = next_phase;
+  return previous_phase;
+}
+
+// Entry points terminal_uart.c calls to update cells are linked with
+// --wrap, rasterization they trigger is charged back by the callbacks.
+// Wrappers are declared with the type of the wrapped function so the
+// compiler checks their parameters
+#define WRAP_CELLS(name, params, args)                                         \
+  __typeof__(terminal_screen_##name) __real_terminal_screen_##name,            \
+      __wrap_terminal_screen_##name;                                           \
+  void __wrap_terminal_screen_##name params {                                  \
+    enum bench_phase previous_phase = enter_phase(PHASE_CELLS);                \
+    __real_terminal_screen_##name args;                                        \
+    enter_phase(previous_phase);                                               \
+  }
+
+WRAP_CELLS(scroll,
+           (struct terminal * terminal, enum scroll scroll, size_t from_row,
+            size_t rows),
+           (terminal, scroll, from_row, rows))
+WRAP_CELLS(clear_to_right, (struct terminal * terminal), (terminal))
+WRAP_CELLS(clear_to_left, (struct terminal * terminal), (terminal))
+WRAP_CELLS(clear_row, (struct terminal * terminal), (terminal))
+WRAP_CELLS(clear_to_top, (struct terminal * terminal), (terminal))
+WRAP_CELLS(clear_to_bottom, (struct terminal * terminal), (terminal))
+WRAP_CELLS(clear_all, (struct terminal * terminal), (terminal))
+WRAP_CELLS(index, (struct terminal * terminal, int16_t rows),
+           (terminal, rows))
+WRAP_CELLS(reverse_index, (struct terminal * terminal, int16_t rows),
+           (terminal, rows))
+WRAP_CELLS(delete, (struct terminal * terminal, size_t cols),
+           (terminal, cols))
+WRAP_CELLS(insert, (struct terminal * terminal, size_t cols),
+           (terminal, cols))
+WRAP_CELLS(erase, (struct terminal * terminal, size_t cols),
+           (terminal, cols))
+
+__typeof__(terminal_screen_put_codepoint) __real_terminal_screen_put_codepoint,
+    __wrap_terminal_screen_put_codepoint;
+
+void __wrap_terminal_screen_put_codepoint(struct terminal *terminal,
+                                          codepoint_t codepoint) {
+  enum bench_phase previous_phase = enter_phase(PHASE_CELLS);
+  __real_terminal_screen_put_codepoint(terminal, codepoint);
+  enter_phase(previous_phase);
+  characters++;
+}
+
+__typeof__(terminal_screen_put_codepoints)
+    __real_terminal_screen_put_codepoints,
+    __wrap_terminal_screen_put_codepoints;
+
+void __wrap_terminal_screen_put_codepoints(struct terminal *terminal,
+                                           const codepoint_t *codepoints,
+                                           size_t count) {
+  enum bench_phase previous_phase = enter_phase(PHASE_CELLS);
+  __real_terminal_screen_put_codepoints(terminal, codepoints, count);
+  enter_phase(previous_phase);
+  characters += count;
+}
+
+static void reset() {}
+
+static void yield() {}
+
+static void activate_config() {}
+
+static void write_config(struct terminal_config *terminal_config_copy) {}
+
+static void keyboard_set_leds(struct lock_state state) {}
+
+static void uart_transmit(character_t *characters, size_t size, size_t head) {}
+
+static void screen_draw_codepoint_callback(struct format format, size_t row,
+                                           size_t col, codepoint_t codepoint,
+                                           enum font font, bool italic,
+                                           bool underlined, bool crossedout,
+                                           color_t active, color_t inactive) {
+  enum bench_phase previous_phase = enter_phase(PHASE_RASTER);
+  screen_draw_codepoint(&screen, row, col, codepoint, font, italic,
+                        underlined, crossedout, active, inactive);
+  enter_phase(previous_phase);
+}
+
+static void screen_draw_cursor_callback(struct format format,
+                                        codepoint_t codepoint, enum font font,
+                                        bool italic, bool underlined,
+                                        bool crossedout, color_t active,
+                                        color_t inactive) {
+  enum bench_phase previous_phase = enter_phase(PHASE_RASTER);
+  screen_draw_cursor(&screen, codepoint, font, italic, underlined, crossedout,
+                     active, inactive);
+  enter_phase(previous_phase);
+}
+
+static void screen_show_cursor_callback(struct format format, size_t row,
+                                        size_t col) {}
+
+static void screen_hide_cursor_callback(struct format format) {}
+
+static void screen_set_mode_callback(struct format format, bool mode) {}
+
+static void screen_set_palette_callback(struct format format,
+                                        const rgb_t *palette) {}
+
+static void screen_clear_rows_callback(struct format format, size_t from_row,
+                                       size_t to_row, color_t inactive) {
+  enum bench_phase previous_phase = enter_phase(PHASE_RASTER);
+  screen_clear_rows(&screen, from_row, to_row, inactive, yield);
+  enter_phase(previous_phase);
+}
+
+static void screen_clear_cols_callback(struct format format, size_t row,
+                                       size_t from_col, size_t to_col,
+                                       color_t inactive) {
+  enum bench_phase previous_phase = enter_phase(PHASE_RASTER);
+  screen_clear_cols(&screen, row, from_col, to_col, inactive, yield);
+  enter_phase(previous_phase);
+}
+
+static void screen_scroll_callback(struct format format, enum scroll scroll,
+                                   size_t from_row, size_t to_row, size_t rows,
+                                   color_t inactive) {
+  enum bench_phase previous_phase = enter_phase(PHASE_RASTER);
+  screen_scroll(&screen, scroll, from_row, to_row, rows, inactive, yield);
+  enter_phase(previous_phase);
+}
+
+static void screen_shift_right_callback(struct format format, size_t row,
+                                        size_t col, size_t cols,
+                                        color_t inactive) {
+  enum bench_phase previous_phase = enter_phase(PHASE_RASTER);
+  screen_shift_right(&screen, row, col, cols, inactive, yield);
+  enter_phase(previous_phase);
+}
+
+static void screen_shift_left_callback(struct format format, size_t row,
+                                       size_t col, size_t cols,
+                                       color_t inactive) {
+  enum bench_phase previous_phase = enter_phase(PHASE_RASTER);
+  screen_shift_left(&screen, row, col, cols, inactive, yield);
+  enter_phase(previous_phase);
+}
+
+static void screen_test_callback(struct format format,
+                                 enum screen_test screen_test) {}
+
+static struct terminal_callbacks callbacks = {
+    .keyboard_set_leds = keyboard_set_leds,
+    .uart_transmit = uart_transmit,
+    .screen_draw_codepoint = screen_draw_codepoint_callback,
+    .screen_draw_cursor = screen_draw_cursor_callback,
+    .screen_show_cursor = screen_show_cursor_callback,
+    .screen_hide_cursor = screen_hide_cursor_callback,
+    .screen_set_mode = screen_set_mode_callback,
+    .screen_set_palette = screen_set_palette_callback,
+    .screen_clear_rows = screen_clear_rows_callback,
+    .screen_clear_cols = screen_clear_cols_callback,
+    .screen_scroll = screen_scroll_callback,
+    .screen_shift_left = screen_shift_left_callback,
+    .screen_shift_right = screen_shift_right_callback,
+    .screen_test = screen_test_callback,
+    .reset = reset,
+    .yield = yield,
+    .activate_config = activate_config,
+    .write_config = write_config};
+
+struct capture {
+  const char *name;
+  character_t *data;
+  size_t size;
+  size_t capacity;
+};
+
+static void append(struct capture *capture, const char *string,
+                   size_t length) {
+  if (capture->size + length > capture->capacity) {
+    while (capture->size + length > capture->capacity)
+      capture->capacity = capture->capacity ? capture->capacity * 2 : 4096;
+
+    capture->data = realloc(capture->data, capture->capacity);
+  }
+
+  memcpy(capture->data + capture->size, string, length);
+  capture->size += length;
+}
+
+static void appendf(struct capture *capture, const char *format, ...) {
+  char string[512];
+  va_list args;
+
+  va_start(args, format);
+  int length = vsnprintf(string, sizeof(string), format, args);
+  va_end(args);
+
+  append(capture, string,
+         length < (int)sizeof(string) ? length : sizeof(string) - 1);
+}
+
+static uint32_t random_state;
+
+static uint32_t get_random(uint32_t range) {
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 17;
+  random_state ^= random_state << 5;
+  return random_state % range;
+}
+
+#define PICK(array) (array[get_random(sizeof(array) / sizeof(array[0]))])
+
+static const char *const words[] = {
+    "request", "client", "buffer",  "timeout", "session", "handler",
+    "cache",   "socket", "payload", "retry",   "index",   "commit",
+    "queue",   "worker", "config",  "token",   "stream",  "update",
+};
+
+static const char *const identifiers[] = {
+    "terminal", "cursor_row", "cols",   "codepoint", "buffer",
+    "size",     "state",      "format", "callbacks", "character",
+};
+
+static const char *const keywords[] = {
+    "static", "const", "return", "if", "while", "for", "struct", "size_t",
+};
+
+// Lines of a service log as cat prints them
+static void generate_cat_log(struct capture *capture) {
+  static const char *const levels[] = {"INFO ", "INFO ", "DEBUG", "WARN ",
+                                       "ERROR"};
+  static const char *const modules[] = {"http", "db", "cache", "worker",
+                                        "auth"};
+
+  while (capture->size < CAPTURE_SIZE) {
+    uint32_t time = capture->size / 64;
+
+    appendf(capture, "2026-10-17 %02u:%02u:%02u.%03u %s [%s-%u] %s %s id=%08x",
+            time / 3600000 % 24, time / 60000 % 60, time / 1000 % 60,
+            time % 1000, PICK(levels), PICK(modules), get_random(8),
+            PICK(words), PICK(words), get_random(UINT32_MAX));
+
+    // Some lines are long enough to wrap
+    for (uint32_t i = get_random(12); i; --i)
+      appendf(capture, " %s=%u", PICK(words), get_random(100000));
+
+    appendf(capture, " took %u ms\r\n", get_random(2000));
+  }
+}
+
+// Listings in columns with GNU ls default colors
+static void generate_ls_color(struct capture *capture) {
+  static const char *const colors[] = {"", "01;34", "01;32", "01;36",
+                                       "01;31", "01;35"};
+  static const char *const extensions[] = {"",   "",  ".c",   ".h",
+                                           ".o", ".md", ".tar.gz", ".png"};
+
+  while (capture->size < CAPTURE_SIZE) {
+    appendf(capture, "\x1b[01;32muser@host\x1b[00m:\x1b[01;34m~/src"
+                     "\x1b[00m$ ls --color\r\n");
+
+    for (uint32_t entry = 0; entry < 64; ++entry) {
+      char name[32];
+      const char *color = PICK(colors);
+      int length = snprintf(name, sizeof(name), "%s_%s%s", PICK(words),
+                            PICK(words), color[0] ? "" : PICK(extensions));
+
+      if (color[0])
+        appendf(capture, "\x1b[0m\x1b[%sm%s\x1b[0m", color, name);
+      else
+        appendf(capture, "%s", name);
+
+      if (entry % 4 == 3)
+        append(capture, "\r\n", 2);
+      else
+        appendf(capture, "%*s", length < 20 ? 20 - length : 1, "");
+    }
+  }
+}
+
+static void append_code_line(struct capture *capture, uint32_t line) {
+  appendf(capture, "\x1b[38;5;130m%4u \x1b[m", line);
+
+  for (uint32_t indent = get_random(4); indent; --indent)
+    append(capture, "  ", 2);
+
+  switch (get_random(4)) {
+  case 0:
+    appendf(capture, "\x1b[34m// %s %s the %s\x1b[m", PICK(words),
+            PICK(words), PICK(words));
+    break;
+
+  case 1:
+    appendf(capture, "\x1b[38;5;130m%s\x1b[m %s = \x1b[31m\"%s\"\x1b[m;",
+            PICK(keywords), PICK(identifiers), PICK(words));
+    break;
+
+  default:
+    appendf(capture, "\x1b[38;5;130m%s\x1b[m (%s->%s < %u) {", PICK(keywords),
+            PICK(identifiers), PICK(identifiers), get_random(256));
+    break;
+  }
+
+  append(capture, "\x1b[K", 3);
+}
+
+// Vim scrolling a file a line at a time with the scroll region above the
+// ruler, each step draws the new line and updates the ruler
+static void generate_vim_scroll(struct capture *capture) {
+  append(capture, "\x1b[?1049h\x1b[H\x1b[2J", 16);
+
+  for (uint32_t line = 1; line <= 23; ++line) {
+    appendf(capture, "\x1b[%u;1H", line);
+    append_code_line(capture, line);
+  }
+
+  for (uint32_t line = 24; capture->size < CAPTURE_SIZE; ++line) {
+    append(capture, "\x1b[?25l\x1b[1;23r\x1b[23;1H\n\x1b[r\x1b[23;1H", 30);
+    append_code_line(capture, line);
+    appendf(capture, "\x1b[24;63H%u,1%*s%u%%\x1b[%u;5H\x1b[?25h", line,
+            line < 1000 ? 10 : 9, "", line % 100, 12 + line % 10);
+  }
+
+  append(capture, "\x1b[?1049l", 8);
+}
+
+static void append_meter(struct capture *capture, uint32_t row, uint32_t col,
+                         const char *label, uint32_t percent) {
+  uint32_t bars = percent * 30 / 100;
+  uint32_t high_bars = bars / 4;
+
+  appendf(capture, "\x1b[%u;%uH\x1b[36m%s\x1b[39m\x1b[1m[\x1b[m\x1b[32m",
+          row, col, label);
+
+  for (uint32_t i = 0; i < 30; ++i) {
+    if (i == bars - high_bars)
+      append(capture, "\x1b[31m", 5);
+    else if (i == bars)
+      append(capture, "\x1b[90m", 5);
+
+    append(capture, i < bars ? "|" : " ", 1);
+  }
+
+  appendf(capture, "\x1b[39m%3u.%u%%\x1b[1m]\x1b[m", percent,
+          get_random(10));
+}
+
+// Htop refreshing meters and the process list, curses sends the function
+// key bar once
+static void generate_htop(struct capture *capture) {
+  static const char *const users[] = {"root", "user", "www-data", "postgres"};
+  static const char *const commands[] = {
+      "/usr/bin/python3 manage.py runserver", "postgres: writer process",
+      "nginx: worker process", "/usr/lib/systemd/systemd-journald",
+      "sshd: user@pts/0", "htop", "tmux new -s main", "-bash"};
+
+  append(capture, "\x1b[?1049h\x1b[H\x1b[2J\x1b[24;1H", 22);
+
+  for (uint32_t key = 1; key <= 10; ++key)
+    appendf(capture, "\x1b[30;46mF%u\x1b[39;49m%-6s", key, PICK(words));
+
+  for (uint32_t frame = 0; capture->size < CAPTURE_SIZE; ++frame) {
+    append(capture, "\x1b[?25l", 6);
+
+    for (uint32_t cpu = 0; cpu < 4; ++cpu) {
+      char label[4];
+
+      snprintf(label, sizeof(label), "%3u", cpu + 1);
+      append_meter(capture, cpu + 1, 1, label, get_random(101));
+    }
+
+    append_meter(capture, 5, 1, "Mem", 40 + get_random(10));
+    append_meter(capture, 6, 1, "Swp", get_random(5));
+    appendf(capture,
+            "\x1b[2;45H\x1b[36mTasks: \x1b[1m%u\x1b[m\x1b[36m, \x1b[1m%u"
+            "\x1b[m\x1b[36m thr; \x1b[1m%u\x1b[m\x1b[36m running\x1b[K"
+            "\x1b[3;45HLoad average: \x1b[1m%u.%02u \x1b[m\x1b[36m%u.%02u "
+            "%u.%02u\x1b[K\x1b[4;45HUptime: \x1b[1m%02u:%02u:%02u\x1b[m\x1b[K",
+            80 + get_random(20), 200 + get_random(50), 1 + get_random(4),
+            get_random(4), get_random(100), get_random(4), get_random(100),
+            get_random(4), get_random(100), frame / 3600 % 24,
+            frame / 60 % 60, frame % 60);
+
+    append(capture,
+           "\x1b[8;1H\x1b[30;42m    PID USER      PRI  NI  VIRT   RES   SHR "
+           "S CPU% MEM%   TIME+  Command\x1b[K\x1b[m",
+           89);
+
+    for (uint32_t row = 9; row < 24; ++row) {
+      bool selected = row == 9 + frame % 15;
+
+      appendf(capture,
+              "\x1b[%u;1H%s%7u %-9s %3u %3d %5uM %5uM %5uM %c %4u.%u %4u.%u "
+              "%3u:%02u.%02u %s\x1b[K\x1b[m",
+              row, selected ? "\x1b[30;46m" : "", 1 + get_random(40000),
+              PICK(users), 20, 0, get_random(4096), get_random(512),
+              get_random(128), get_random(8) ? 'S' : 'R', get_random(100),
+              get_random(10), get_random(10), get_random(10),
+              get_random(100), get_random(60), get_random(100),
+              PICK(commands));
+    }
+
+    append(capture, "\x1b[9;1H\x1b[?25h", 12);
+  }
+
+  append(capture, "\x1b[?1049l", 8);
+}
+
+// Shell output in a tmux pane above the status line, the status line is
+// redrawn every few lines with the cursor put back in the pane
+static void generate_tmux_status(struct capture *capture) {
+  append(capture, "\x1b[?1049h\x1b[H\x1b[2J\x1b[1;23r", 22);
+
+  for (uint32_t line = 0; capture->size < CAPTURE_SIZE; ++line) {
+    appendf(capture, "\x1b[23;1H%s %s %s %u", PICK(words), PICK(words),
+            PICK(words), get_random(100000));
+
+    for (uint32_t i = get_random(6); i; --i)
+      appendf(capture, " \x1b[1m%s\x1b[m %s", PICK(words), PICK(words));
+
+    append(capture, "\r\n", 2);
+
+    if (line % 8 == 0)
+      appendf(capture,
+              "\x1b[?25l\x1b[24;1H\x1b[30m\x1b[42m[main] 0:vim- 1:bash* "
+              "2:htop  \x1b[K\x1b[24;58H\"host\" %02u:%02u 17-Oct-26"
+              "\x1b[39m\x1b[49m\x1b[23;%uH\x1b[?25h",
+              line / 60 % 24, line % 60, 1 + get_random(40));
+  }
+
+  append(capture, "\x1b[r\x1b[?1049l", 11);
+}
+
+// Color test printing the 256 color palette as background blocks and
+// foreground numbers, then direct color gradients
+static void generate_color_256(struct capture *capture) {
+  while (capture->size < CAPTURE_SIZE) {
+    for (uint32_t color = 0; color < 256; ++color)
+      appendf(capture, "\x1b[48;5;%um  %s", color,
+              color % 16 == 15 ? "\x1b[m\r\n" : "");
+
+    for (uint32_t color = 0; color < 256; ++color)
+      appendf(capture, "\x1b[38;5;%um%4u%s", color, color,
+              color % 16 == 15 ? "\x1b[m\r\n" : "");
+
+    for (uint32_t row = 0; row < 4; ++row) {
+      for (uint32_t col = 0; col < 80; ++col)
+        appendf(capture, "\x1b[48;2;%u;%u;%um\x1b[38;2;%u;%u;%um%c",
+                col * 255 / 79, row * 85, 255 - col * 255 / 79,
+                255 - col * 255 / 79, 255 - row * 85, col * 255 / 79,
+                "/\\"[col % 2]);
+
+      append(capture, "\x1b[m\r\n", 5);
+    }
+  }
+}
+
+// Log window between a fixed header and footer scrolled forward and back
+// with index, reverse index, SU, SD, IL and DL
+static void generate_decstbm_scroll(struct capture *capture) {
+  append(capture, "\x1b[H\x1b[2J", 7);
+
+  for (uint32_t step = 0; capture->size < CAPTURE_SIZE; ++step) {
+    uint32_t top = step % 64 < 32 ? 3 : 5;
+    uint32_t bottom = step % 64 < 32 ? 22 : 18;
+
+    if (step % 32 == 0)
+      appendf(capture,
+              "\x1b[r\x1b[1;1H\x1b[7m monitor %u \x1b[K\x1b[m\x1b[24;1H\x1b[7m"
+              " q quit  f follow  / search\x1b[K\x1b[m\x1b[%u;%ur",
+              step, top, bottom);
+
+    switch (step % 8) {
+    case 3:
+      appendf(capture, "\x1b[%u;1H\x1bM", top);
+      break;
+
+    case 5:
+      appendf(capture, "\x1b[%uS\x1b[%u;1H", 1 + step % 3, bottom);
+      break;
+
+    case 6:
+      appendf(capture, "\x1b[%uT\x1b[%u;1H", 1 + step % 2, top);
+      break;
+
+    case 7:
+      appendf(capture, "\x1b[%u;1H\x1b[%c", top + get_random(bottom - top),
+              step % 16 == 7 ? 'L' : 'M');
+      break;
+
+    default:
+      appendf(capture, "\x1b[%u;1H\n", bottom);
+      break;
+    }
+
+    appendf(capture, "\x1b[3%um%s\x1b[m %s %s %u\x1b[K", 1 + step % 7,
+            PICK(words), PICK(words), PICK(words), get_random(100000));
+  }
+
+  append(capture, "\x1b[r", 3);
+}
+
+struct workload {
+  const char *name;
+  void (*generate)(struct capture *capture);
+};
+
+static const struct workload workloads[] = {
+    {"cat-log", generate_cat_log},
+    {"ls-color", generate_ls_color},
+    {"vim-scroll", generate_vim_scroll},
+    {"htop", generate_htop},
+    {"tmux-status", generate_tmux_status},
+    {"color-256", generate_color_256},
+    {"decstbm-scroll", generate_decstbm_scroll},
+};
+
+#define WORKLOADS_COUNT (sizeof(workloads) / sizeof(workloads[0]))
+
+static bool load_capture(const char *path, struct capture *capture) {
+  FILE *file = fopen(path, "rb");
+
+  if (!file) {
+    perror(path);
+    return false;
+  }
+
+  char buffer[4096];
+  size_t size;
+
+  while ((size = fread(buffer, 1, sizeof(buffer), file)))
+    append(capture, buffer, size);
+
+  fclose(file);
+
+  const char *name = strrchr(path, '/');
+  capture->name = name ? name + 1 : path;
+  return true;
+}
+
+// Captures are received in chunks like the main loop takes them from the
+// UART ring, the screen is updated every time a full ring is drained
+static uint64_t replay(const struct capture *capture) {
+  static struct terminal terminal;
+
+  memset(screen_buffer, 0, sizeof(screen_buffer));
+  terminal_init(&terminal, &callbacks, default_cells, alt_cells, tab_stops,
+                TAB_STOPS_SIZE, &terminal_config, transmit_buffer,
+                TRANSMIT_BUFFER_SIZE);
+
+  phase = PHASE_PARSE;
+  uint64_t start = phase_start = get_time();
+
+  for (size_t offset = 0; offset < capture->size;) {
+    size_t end = offset + RECEIVE_BUFFER_SIZE;
+
+    if (end > capture->size)
+      end = capture->size;
+
+    while (offset < end) {
+      size_t chunk = end - offset;
+
+      if (chunk > RECEIVE_CHUNK_SIZE)
+        chunk = RECEIVE_CHUNK_SIZE;
+
+      terminal_uart_receive_buffer(&terminal, capture->data + offset, chunk);
+      offset += chunk;
+    }
+
+    enum bench_phase previous_phase = enter_phase(PHASE_CELLS);
+    terminal_screen_update(&terminal);
+    enter_phase(previous_phase);
+  }
+
+  enter_phase(PHASE_PARSE);
+  return get_time() - start;
+}
+
+// Throughput is timed without profiling, the split between phases is taken
+// from a separate profiled replay since reading the clock on every callback
+// slows the core down
+static void run(const struct capture *capture, size_t repeat) {
+  uint64_t time = UINT64_MAX;
+
+  characters = 0;
+  memset(phase_time, 0, sizeof(phase_time));
+
+  for (size_t i = 0; i < repeat; ++i) {
+    uint64_t replay_time = replay(capture);
+
+    if (replay_time < time)
+      time = replay_time;
+  }
+
+  uint64_t replay_characters = characters / repeat;
+
+  profiling = true;
+  replay(capture);
+  profiling = false;
+
+  uint64_t profiled_time =
+      phase_time[PHASE_PARSE] + phase_time[PHASE_CELLS] +
+      phase_time[PHASE_RASTER];
+
+  if (!time)
+    time = 1;
+  if (!profiled_time)
+    profiled_time = 1;
+
+  double seconds = time / 1e9;
+  double bytes_per_second = capture->size / seconds;
+
+  printf("%-16s %9zu %9.2f %11.0f %6.1f%% %6.1f%% %6.1f%% %12.0f\n",
+         capture->name, capture->size, bytes_per_second / 1e6,
+         replay_characters / seconds,
+         100.0 * phase_time[PHASE_PARSE] / profiled_time,
+         100.0 * phase_time[PHASE_CELLS] / profiled_time,
+         100.0 * phase_time[PHASE_RASTER] / profiled_time,
+         bytes_per_second * UART_FRAME_BITS);
+}
+
+static void usage(const char *name) {
+  fprintf(stderr,
+          "usage: %s [-n REPEAT] [-w WORKLOAD] [CAPTURE...]\n"
+          "  -n  replays timed per workload, the fastest is reported\n"
+          "  -w  run only the named built-in workload\n"
+          "  CAPTURE files are replayed instead of the built-in workloads\n",
+          name);
+}
+
+int main(int argc, char **argv) {
+  size_t repeat = DEFAULT_REPEAT;
+  const char *workload_name = NULL;
+  int option;
+
+  while ((option = getopt(argc, argv, "n:w:")) != -1) {
+    switch (option) {
+    case 'n':
+      repeat = atoi(optarg);
+      if (!repeat) {
+        usage(argv[0]);
+        return 1;
+      }
+      break;
+
+    case 'w':
+      workload_name = optarg;
+      break;
+
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  printf("%-16s %9s %9s %11s %7s %7s %7s %12s\n", "workload", "bytes",
+         "MB/s", "chars/s", "parse", "cells", "raster", "8N1 baud");
+
+  if (optind < argc) {
+    for (int i = optind; i < argc; ++i) {
+      struct capture capture = {0};
+
+      if (!load_capture(argv[i], &capture))
+        return 1;
+
+      run(&capture, repeat);
+      free(capture.data);
+    }
+
+    return 0;
+  }
+
+  bool found = false;
+
+  for (size_t i = 0; i < WORKLOADS_COUNT; ++i) {
+    if (workload_name && strcmp(workload_name, workloads[i].name))
+      continue;
+
+    struct capture capture = {.name = workloads[i].name};
+
+    // Every workload is generated from the same seed so runs compare
+    random_state = 0x2545f491;
+    workloads[i].generate(&capture);
+    run(&capture, repeat);
+    free(capture.data);
+    found = true;
+  }
+
+  if (!found) {
+    fprintf(stderr, "unknown workload %s\n", workload_name);
+    return 1;
+  }
+
+  return 0;
+}
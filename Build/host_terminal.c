@@ -0,0 +1,355 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "rgb.h"
+#include "screen.h"
+#include "terminal.h"
+
+#include "FontProblems/bold.h"
+#include "FontProblems/font_index.h"
+#include "FontProblems/normal.h"
+
+// Terminal core built for Linux, drawing into a virtual framebuffer that is
+// written out as a PPM image
+
+#define FONT_WIDTH 8
+#define FONT_HEIGHT 16
+
+#define MAX_COLS 80
+#define MAX_ROWS 30
+#define TAB_STOPS_SIZE (MAX_COLS / 8)
+
+#define TRANSMIT_BUFFER_SIZE 256
+#define RECEIVE_CHUNK_SIZE 4096
+
+static const struct bitmap_font normal_bitmap_font = {
+    .height = FONT_HEIGHT,
+    .width = FONT_WIDTH,
+    .data = normal_font_data,
+    .pages = normal_font_pages,
+    .page_glyphs = normal_font_page_glyphs,
+};
+
+static const struct bitmap_font bold_bitmap_font = {
+    .height = FONT_HEIGHT,
+    .width = FONT_WIDTH,
+    .data = bold_font_data,
+    .pages = bold_font_pages,
+    .page_glyphs = bold_font_page_glyphs,
+};
+
+static uint8_t screen_buffer[FONT_WIDTH * FONT_HEIGHT * MAX_COLS * MAX_ROWS];
+static uint8_t cursor_buffers[2][FONT_WIDTH * FONT_HEIGHT];
+
+static struct screen screen_24_rows = {
+    .format = {.rows = 24, .cols = 80},
+    .char_width = FONT_WIDTH,
+    .char_height = FONT_HEIGHT,
+    .buffer = screen_buffer,
+    .blitter = &software_blitter,
+    .normal_bitmap_font = &normal_bitmap_font,
+    .bold_bitmap_font = &bold_bitmap_font,
+    .cursor_buffers = {cursor_buffers[0], cursor_buffers[1]},
+};
+
+static struct screen screen_30_rows = {
+    .format = {.rows = 30, .cols = 80},
+    .char_width = FONT_WIDTH,
+    .char_height = FONT_HEIGHT,
+    .buffer = screen_buffer,
+    .blitter = &software_blitter,
+    .normal_bitmap_font = &normal_bitmap_font,
+    .bold_bitmap_font = &bold_bitmap_font,
+    .cursor_buffers = {cursor_buffers[0], cursor_buffers[1]},
+};
+
+static const rgb_t *screen_palette = rgb_table;
+static bool screen_mode = false;
+
+static bool cursor_shown = false;
+static size_t cursor_row;
+static size_t cursor_col;
+
+static struct visual_cell default_cells[MAX_ROWS * MAX_COLS];
+static struct visual_cell alt_cells[MAX_ROWS * MAX_COLS];
+static uint8_t tab_stops[TAB_STOPS_SIZE];
+static character_t transmit_buffer[TRANSMIT_BUFFER_SIZE];
+
+static struct terminal_config terminal_config = {
+    .format_rows = FORMAT_24_ROWS,
+
+    .charset = CHARSET_UTF8,
+    .keyboard_compatibility = KEYBOARD_COMPATIBILITY_PC,
+    .receive_c1_mode = C1_MODE_8BIT,
+    .transmit_c1_mode = C1_MODE_7BIT,
+
+    .auto_wrap_mode = true,
+    .screen_mode = false,
+
+    .send_receive_mode = true,
+
+    .new_line_mode = false,
+    .cursor_key_mode = false,
+    .auto_repeat_mode = true,
+    .ansi_mode = true,
+    .backspace_mode = false,
+    .application_keypad_mode = false,
+    .keyboard_layout = KEYBOARD_LAYOUT_US,
+
+    .start_up = START_UP_NONE,
+
+    .flow_control = false,
+};
+
+static struct screen *get_screen(struct format format) {
+  if (format.cols == 80) {
+    if (format.rows == 24)
+      return &screen_24_rows;
+    else if (format.rows == 30)
+      return &screen_30_rows;
+  }
+
+  return NULL;
+}
+
+static void reset() {}
+
+static void yield() {}
+
+static void activate_config() {}
+
+static void write_config(struct terminal_config *terminal_config_copy) {}
+
+static void keyboard_set_leds(struct lock_state state) {}
+
+// Replies to the host are written to standard output
+static void uart_transmit(character_t *characters, size_t size, size_t head) {
+  fwrite(characters, 1, size, stdout);
+}
+
+static void screen_draw_codepoint_callback(struct format format, size_t row,
+                                           size_t col, codepoint_t codepoint,
+                                           enum font font, bool italic,
+                                           bool underlined, bool crossedout,
+                                           color_t active, color_t inactive) {
+  screen_draw_codepoint(get_screen(format), row, col, codepoint, font, italic,
+                        underlined, crossedout, active, inactive);
+}
+
+static void screen_draw_cursor_callback(struct format format,
+                                        codepoint_t codepoint, enum font font,
+                                        bool italic, bool underlined,
+                                        bool crossedout, color_t active,
+                                        color_t inactive) {
+  screen_draw_cursor(get_screen(format), codepoint, font, italic, underlined,
+                     crossedout, active, inactive);
+}
+
+static void screen_show_cursor_callback(struct format format, size_t row,
+                                        size_t col) {
+  cursor_shown = true;
+  cursor_row = row;
+  cursor_col = col;
+}
+
+static void screen_hide_cursor_callback(struct format format) {
+  cursor_shown = false;
+}
+
+static void screen_set_mode_callback(struct format format, bool mode) {
+  screen_mode = mode;
+}
+
+static void screen_set_palette_callback(struct format format,
+                                        const rgb_t *palette) {
+  screen_palette = palette;
+}
+
+static void screen_clear_rows_callback(struct format format, size_t from_row,
+                                       size_t to_row, color_t inactive) {
+  screen_clear_rows(get_screen(format), from_row, to_row, inactive, yield);
+}
+
+static void screen_clear_cols_callback(struct format format, size_t row,
+                                       size_t from_col, size_t to_col,
+                                       color_t inactive) {
+  screen_clear_cols(get_screen(format), row, from_col, to_col, inactive,
+                    yield);
+}
+
+static void screen_scroll_callback(struct format format, enum scroll scroll,
+                                   size_t from_row, size_t to_row, size_t rows,
+                                   color_t inactive) {
+  screen_scroll(get_screen(format), scroll, from_row, to_row, rows, inactive,
+                yield);
+}
+
+static void screen_shift_right_callback(struct format format, size_t row,
+                                        size_t col, size_t cols,
+                                        color_t inactive) {
+  screen_shift_right(get_screen(format), row, col, cols, inactive, yield);
+}
+
+static void screen_shift_left_callback(struct format format, size_t row,
+                                       size_t col, size_t cols,
+                                       color_t inactive) {
+  screen_shift_left(get_screen(format), row, col, cols, inactive, yield);
+}
+
+static void screen_test_callback(struct format format,
+                                 enum screen_test screen_test) {}
+
+// Screen mode swaps the default colors the way the LTDC CLUTs are loaded, the
+// cursor layer also swaps the inverted default colors
+static color_t screen_color(color_t color, bool cursor) {
+  if (screen_mode) {
+    if (color == DEFAULT_ACTIVE_COLOR)
+      return DEFAULT_INACTIVE_COLOR;
+    else if (color == DEFAULT_INACTIVE_COLOR)
+      return DEFAULT_ACTIVE_COLOR;
+    else if (cursor && color == (color_t)~DEFAULT_ACTIVE_COLOR)
+      return ~DEFAULT_INACTIVE_COLOR;
+    else if (cursor && color == (color_t)~DEFAULT_INACTIVE_COLOR)
+      return ~DEFAULT_ACTIVE_COLOR;
+  }
+
+  return color;
+}
+
+// Colors are looked up the way the LTDC looks up its CLUT, the cursor cell
+// is taken from the shown cursor buffer the way the overlay layer shows it
+static bool write_ppm(const char *path, struct screen *screen) {
+  FILE *file = fopen(path, "wb");
+
+  if (!file) {
+    perror(path);
+    return false;
+  }
+
+  size_t width = screen->format.cols * screen->char_width;
+  size_t height = screen->format.rows * screen->char_height;
+
+  fprintf(file, "P6\n%zu %zu\n255\n", width, height);
+
+  for (size_t y = 0; y < height; ++y)
+    for (size_t x = 0; x < width; ++x) {
+      size_t row = y / screen->char_height;
+      size_t col = x / screen->char_width;
+      uint8_t color = screen->buffer[y * width + x];
+      bool cursor = cursor_shown && row == cursor_row && col == cursor_col;
+
+      if (cursor)
+        color = screen->cursor_buffers[screen->cursor_buffer]
+                                      [(y % screen->char_height) *
+                                           screen->char_width +
+                                       x % screen->char_width];
+
+      rgb_t rgb = screen_palette[screen_color(color, cursor)];
+
+      fputc((rgb >> 16) & 0xff, file);
+      fputc((rgb >> 8) & 0xff, file);
+      fputc(rgb & 0xff, file);
+    }
+
+  fclose(file);
+  return true;
+}
+
+static void usage(const char *name) {
+  fprintf(stderr,
+          "usage: %s [-r ROWS] [-c CHARSET] [-o IMAGE.ppm] [INPUT]\n"
+          "  -r  24 or 30 rows\n"
+          "  -c  0 UTF-8, 1 ISO 8859-1, 2 IBM PC\n"
+          "  -o  write the screen after INPUT (or standard input)\n",
+          name);
+}
+
+int main(int argc, char **argv) {
+  const char *image_path = NULL;
+  int option;
+
+  while ((option = getopt(argc, argv, "r:c:o:")) != -1) {
+    switch (option) {
+    case 'r':
+      if (atoi(optarg) == 24)
+        terminal_config.format_rows = FORMAT_24_ROWS;
+      else if (atoi(optarg) == 30)
+        terminal_config.format_rows = FORMAT_30_ROWS;
+      else {
+        usage(argv[0]);
+        return 1;
+      }
+      break;
+
+    case 'c':
+      terminal_config.charset = atoi(optarg);
+      break;
+
+    case 'o':
+      image_path = optarg;
+      break;
+
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  if (argc - optind > 1) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  FILE *input = stdin;
+
+  if (optind < argc && !(input = fopen(argv[optind], "rb"))) {
+    perror(argv[optind]);
+    return 1;
+  }
+
+  static struct terminal terminal;
+  struct terminal_callbacks callbacks = {
+      .keyboard_set_leds = keyboard_set_leds,
+      .uart_transmit = uart_transmit,
+      .screen_draw_codepoint = screen_draw_codepoint_callback,
+      .screen_draw_cursor = screen_draw_cursor_callback,
+      .screen_show_cursor = screen_show_cursor_callback,
+      .screen_hide_cursor = screen_hide_cursor_callback,
+      .screen_set_mode = screen_set_mode_callback,
+      .screen_set_palette = screen_set_palette_callback,
+      .screen_clear_rows = screen_clear_rows_callback,
+      .screen_clear_cols = screen_clear_cols_callback,
+      .screen_scroll = screen_scroll_callback,
+      .screen_shift_left = screen_shift_left_callback,
+      .screen_shift_right = screen_shift_right_callback,
+      .screen_test = screen_test_callback,
+      .reset = reset,
+      .yield = yield,
+      .activate_config = activate_config,
+      .write_config = write_config};
+  terminal_init(&terminal, &callbacks, default_cells, alt_cells, tab_stops,
+                TAB_STOPS_SIZE, &terminal_config, transmit_buffer,
+                TRANSMIT_BUFFER_SIZE);
+
+  static character_t buffer[RECEIVE_CHUNK_SIZE];
+  size_t size;
+
+  while ((size = fread(buffer, 1, RECEIVE_CHUNK_SIZE, input))) {
+    terminal_uart_receive_buffer(&terminal, buffer, size);
+    terminal_screen_update(&terminal);
+  }
+
+  if (input != stdin)
+    fclose(input);
+
+  fflush(stdout);
+
+  if (image_path && !write_ppm(image_path, get_screen(terminal.format)))
+    return 1;
+
+  return 0;
+}
@@ -0,0 +1,188 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "terminal.h"
+
+// Checks that cells keep their exact attributes when the screen holds more
+// distinct SGR combinations than a small table could
+
+#define MAX_COLS 80
+#define MAX_ROWS 30
+#define TAB_STOPS_SIZE (MAX_COLS / 8)
+
+#define TRANSMIT_BUFFER_SIZE 256
+
+#define TEST_CELLS 300
+
+static struct visual_cell default_cells[MAX_ROWS * MAX_COLS];
+static struct visual_cell alt_cells[MAX_ROWS * MAX_COLS];
+static uint8_t tab_stops[TAB_STOPS_SIZE];
+static character_t transmit_buffer[TRANSMIT_BUFFER_SIZE];
+
+static struct terminal_config terminal_config = {
+    .format_rows = FORMAT_24_ROWS,
+    .charset = CHARSET_UTF8,
+    .auto_wrap_mode = true,
+    .send_receive_mode = true,
+    .ansi_mode = true,
+};
+
+static void reset() {}
+
+static void yield() {}
+
+static void activate_config() {}
+
+static void write_config(struct terminal_config *terminal_config_copy) {}
+
+static void keyboard_set_leds(struct lock_state state) {}
+
+static void uart_transmit(character_t *characters, size_t size, size_t head) {
+}
+
+static void screen_draw_codepoint(struct format format, size_t row, size_t col,
+                                  codepoint_t codepoint, enum font font,
+                                  bool italic, bool underlined,
+                                  bool crossedout, color_t active,
+                                  color_t inactive) {}
+
+static void screen_draw_cursor(struct format format, codepoint_t codepoint,
+                               enum font font, bool italic, bool underlined,
+                               bool crossedout, color_t active,
+                               color_t inactive) {}
+
+static void screen_show_cursor(struct format format, size_t row, size_t col) {}
+
+static void screen_hide_cursor(struct format format) {}
+
+static void screen_set_mode(struct format format, bool mode) {}
+
+static void screen_set_palette(struct format format, const rgb_t *palette) {}
+
+static void screen_clear_rows(struct format format, size_t from_row,
+                              size_t to_row, color_t inactive) {}
+
+static void screen_clear_cols(struct format format, size_t row,
+                              size_t from_col, size_t to_col,
+                              color_t inactive) {}
+
+static void screen_scroll(struct format format, enum scroll scroll,
+                          size_t from_row, size_t to_row, size_t rows,
+                          color_t inactive) {}
+
+static void screen_shift_right(struct format format, size_t row, size_t col,
+                               size_t cols, color_t inactive) {}
+
+static void screen_shift_left(struct format format, size_t row, size_t col,
+                              size_t cols, color_t inactive) {}
+
+static void screen_test(struct format format, enum screen_test screen_test) {}
+
+static void receive(struct terminal *terminal, const char *string) {
+  terminal_uart_receive_buffer(terminal, (character_t *)string,
+                               strlen(string));
+  terminal_screen_update(terminal);
+}
+
+static color_t test_active_color(int i) { return i % 256; }
+
+static color_t test_inactive_color(int i) { return i / 2; }
+
+// Explicit colors on the default colors' entries are kept on the cube entries
+// of the same color
+static color_t cell_color(color_t color) {
+  if (color == DEFAULT_ACTIVE_COLOR)
+    return 231;
+  else if (color == DEFAULT_INACTIVE_COLOR)
+    return 16;
+
+  return color;
+}
+
+// Every cell gets its own foreground and background pair
+static void write_cells(struct terminal *terminal) {
+  char sgr[32];
+
+  receive(terminal, "\x1b[H");
+
+  for (int i = 0; i < TEST_CELLS; ++i) {
+    snprintf(sgr, sizeof(sgr), "\x1b[38;5;%d;48;5;%dm%c",
+             test_active_color(i), test_inactive_color(i), 'A' + i % 26);
+    receive(terminal, sgr);
+  }
+
+  receive(terminal, "\x1b[m");
+}
+
+static int check_cells(struct terminal *terminal, const char *stage) {
+  int failures = 0;
+
+  for (int i = 0; i < TEST_CELLS; ++i) {
+    int row = i / MAX_COLS;
+    int col = i % MAX_COLS;
+    const struct visual_cell *cell = &terminal->screen->rows[row][col];
+
+    color_t active = cell_color(test_active_color(i));
+    color_t inactive = cell_color(test_inactive_color(i));
+
+    if (cell->c != 'A' + i % 26 || cell->p.active_color != active ||
+        cell->p.inactive_color != inactive) {
+      fprintf(stderr, "%s: cell (%d,%d) is '%c' %d/%d, expected '%c' %d/%d\n",
+              stage, row, col, cell->c, cell->p.active_color,
+              cell->p.inactive_color, 'A' + i % 26, active, inactive);
+      ++failures;
+    }
+  }
+
+  return failures;
+}
+
+int main() {
+  static struct terminal terminal;
+  struct terminal_callbacks callbacks = {
+      .keyboard_set_leds = keyboard_set_leds,
+      .uart_transmit = uart_transmit,
+      .screen_draw_codepoint = screen_draw_codepoint,
+      .screen_draw_cursor = screen_draw_cursor,
+      .screen_show_cursor = screen_show_cursor,
+      .screen_hide_cursor = screen_hide_cursor,
+      .screen_set_mode = screen_set_mode,
+      .screen_set_palette = screen_set_palette,
+      .screen_clear_rows = screen_clear_rows,
+      .screen_clear_cols = screen_clear_cols,
+      .screen_scroll = screen_scroll,
+      .screen_shift_left = screen_shift_left,
+      .screen_shift_right = screen_shift_right,
+      .screen_test = screen_test,
+      .reset = reset,
+      .yield = yield,
+      .activate_config = activate_config,
+      .write_config = write_config};
+  terminal_init(&terminal, &callbacks, default_cells, alt_cells, tab_stops,
+                TAB_STOPS_SIZE, &terminal_config, transmit_buffer,
+                TRANSMIT_BUFFER_SIZE);
+
+  int failures = 0;
+
+  write_cells(&terminal);
+  failures += check_cells(&terminal, "written");
+
+  // Alternate screen fills its own cells with as many combinations
+  receive(&terminal, "\x1b[?1049h");
+  write_cells(&terminal);
+  failures += check_cells(&terminal, "alternate");
+  receive(&terminal, "\x1b[?1049l");
+  failures += check_cells(&terminal, "restored");
+
+  // Cells moved by insert and delete keep their attributes
+  receive(&terminal, "\x1b[4;1H\x1b[5@\x1b[5P");
+  failures += check_cells(&terminal, "shifted");
+
+  if (failures)
+    return 1;
+
+  printf("test_cells: %d cells ok\n", TEST_CELLS);
+  return 0;
+}
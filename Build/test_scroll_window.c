@@ -0,0 +1,79 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "scroll_window.h"
+
+// Checks how the circular screen buffer is split between the top and the
+// wrapped part of the display window
+
+#define BUFFER 0x20000000
+#define ACTIVE_HEIGHT 480
+#define LINE_BYTES (80 * 8)
+#define CHAR_HEIGHT 16
+
+static int check_layer(const char *name, size_t lines, size_t top_line,
+                       const struct scroll_window_layer *layer, bool enabled,
+                       uint32_t address, size_t y, size_t layer_lines) {
+  if (layer->enabled != enabled) {
+    fprintf(stderr, "%zu lines, top %zu: %s part is %s\n", lines, top_line,
+            name, layer->enabled ? "enabled" : "disabled");
+    return 1;
+  }
+
+  if (!enabled)
+    return 0;
+
+  if (layer->address != address || layer->pitch != LINE_BYTES ||
+      layer->y != y || layer->lines != layer_lines) {
+    fprintf(stderr,
+            "%zu lines, top %zu: %s part at 0x%lx pitch %zu y %zu lines %zu, "
+            "expected 0x%lx pitch %d y %zu lines %zu\n",
+            lines, top_line, name, (unsigned long)layer->address,
+            layer->pitch, layer->y, layer->lines, (unsigned long)address,
+            LINE_BYTES, y, layer_lines);
+    return 1;
+  }
+
+  return 0;
+}
+
+static int check_split(size_t lines, size_t top_line) {
+  size_t y = (ACTIVE_HEIGHT - lines) / 2;
+  struct scroll_window_layer top_layer, wrapped_layer;
+
+  scroll_window_split(BUFFER, LINE_BYTES, lines, top_line, y, &top_layer,
+                      &wrapped_layer);
+
+  return check_layer("top", lines, top_line, &top_layer, true,
+                     BUFFER + top_line * LINE_BYTES, y, lines - top_line) +
+         check_layer("wrapped", lines, top_line, &wrapped_layer,
+                     top_line != 0, BUFFER, y + lines - top_line, top_line);
+}
+
+static int check_rows(size_t rows) {
+  size_t lines = rows * CHAR_HEIGHT;
+  int failures = 0;
+
+  // Window that does not wrap
+  failures += check_split(lines, 0);
+
+  // Wrap at every row boundary
+  for (size_t row = 1; row < rows; ++row)
+    failures += check_split(lines, row * CHAR_HEIGHT);
+
+  // Wrapped part of a single line
+  failures += check_split(lines, lines - 1);
+
+  return failures;
+}
+
+int main() {
+  int failures = check_rows(24) + check_rows(30);
+
+  if (failures)
+    return 1;
+
+  printf("test_scroll_window: ok\n");
+  return 0;
+}
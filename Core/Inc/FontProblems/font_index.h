@@ -0,0 +1,6636 @@
+static const struct bitmap_font_page normal_font_pages[256] = {
+  {0, 0x00, 0xff},
+  {256, 0x00, 0xff},
+  {512, 0x18, 0xdd},
+  {710, 0x00, 0xf6},
+  {957, 0x00, 0xf9},
+  {1207, 0xd0, 0xea},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {1234, 0x0c, 0xf9},
+  {0, 0xff, 0x00},
+  {1472, 0x00, 0xae},
+  {1647, 0x02, 0xd5},
+  {1859, 0x00, 0xc3},
+  {2055, 0x00, 0xd0},
+  {2264, 0x09, 0x24},
+  {2292, 0x00, 0xd9},
+  {2510, 0x3a, 0x6b},
+  {2560, 0x13, 0xeb},
+  {2777, 0x00, 0xff},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {3033, 0x2c, 0x2c},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {3034, 0xa0, 0xb3},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {3054, 0xbe, 0xbe},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {3055, 0xfd, 0xfd},
+};
+
+static const uint16_t normal_font_page_glyphs[3056] = {
+  0x0000,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0001,
+  0x0002,
+  0x0003,
+  0x0004,
+  0x0005,
+  0x0006,
+  0x0007,
+  0x0008,
+  0x0009,
+  0x000a,
+  0x000b,
+  0x000c,
+  0x000d,
+  0x000e,
+  0x000f,
+  0x0010,
+  0x0011,
+  0x0012,
+  0x0013,
+  0x0014,
+  0x0015,
+  0x0016,
+  0x0017,
+  0x0018,
+  0x0019,
+  0x001a,
+  0x001b,
+  0x001c,
+  0x001d,
+  0x001e,
+  0x001f,
+  0x0020,
+  0x0021,
+  0x0022,
+  0x0023,
+  0x0024,
+  0x0025,
+  0x0026,
+  0x0027,
+  0x0028,
+  0x0029,
+  0x002a,
+  0x002b,
+  0x002c,
+  0x002d,
+  0x002e,
+  0x002f,
+  0x0030,
+  0x0031,
+  0x0032,
+  0x0033,
+  0x0034,
+  0x0035,
+  0x0036,
+  0x0037,
+  0x0038,
+  0x0039,
+  0x003a,
+  0x003b,
+  0x003c,
+  0x003d,
+  0x003e,
+  0x003f,
+  0x0040,
+  0x0041,
+  0x0042,
+  0x0043,
+  0x0044,
+  0x0045,
+  0x0046,
+  0x0047,
+  0x0048,
+  0x0049,
+  0x004a,
+  0x004b,
+  0x004c,
+  0x004d,
+  0x004e,
+  0x004f,
+  0x0050,
+  0x0051,
+  0x0052,
+  0x0053,
+  0x0054,
+  0x0055,
+  0x0056,
+  0x0057,
+  0x0058,
+  0x0059,
+  0x005a,
+  0x005b,
+  0x005c,
+  0x005d,
+  0x005e,
+  0x005f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0001,
+  0x0060,
+  0x0061,
+  0x0062,
+  0x0063,
+  0x0064,
+  0x0065,
+  0x0066,
+  0x0067,
+  0x0068,
+  0x0069,
+  0x006a,
+  0x006b,
+  0x006c,
+  0x006d,
+  0x006e,
+  0x006f,
+  0x0070,
+  0x0071,
+  0x0072,
+  0x0073,
+  0x0074,
+  0x0075,
+  0x0076,
+  0x0077,
+  0x0078,
+  0x0079,
+  0x007a,
+  0x007b,
+  0x007c,
+  0x007d,
+  0x007e,
+  0x007f,
+  0x0080,
+  0x0081,
+  0x0082,
+  0x0083,
+  0x0084,
+  0x0085,
+  0x0086,
+  0x0087,
+  0x0088,
+  0x0089,
+  0x008a,
+  0x008b,
+  0x008c,
+  0x008d,
+  0x008e,
+  0x008f,
+  0x0090,
+  0x0091,
+  0x0092,
+  0x0093,
+  0x0094,
+  0x0095,
+  0x0096,
+  0x0097,
+  0x0098,
+  0x0099,
+  0x009a,
+  0x009b,
+  0x009c,
+  0x009d,
+  0x009e,
+  0x009f,
+  0x00a0,
+  0x00a1,
+  0x00a2,
+  0x00a3,
+  0x00a4,
+  0x00a5,
+  0x00a6,
+  0x00a7,
+  0x00a8,
+  0x00a9,
+  0x00aa,
+  0x00ab,
+  0x00ac,
+  0x00ad,
+  0x00ae,
+  0x00af,
+  0x00b0,
+  0x00b1,
+  0x00b2,
+  0x00b3,
+  0x00b4,
+  0x00b5,
+  0x00b6,
+  0x00b7,
+  0x00b8,
+  0x00b9,
+  0x00ba,
+  0x00bb,
+  0x00bc,
+  0x00bd,
+  0x00be,
+  0x00bf,
+  0x00c0,
+  0x00c1,
+  0x00c2,
+  0x00c3,
+  0x00c4,
+  0x00c5,
+  0x00c6,
+  0x00c7,
+  0x00c8,
+  0x00c9,
+  0x00ca,
+  0x00cb,
+  0x00cc,
+  0x00cd,
+  0x00ce,
+  0x008f,
+  0x00cf,
+  0x00d0,
+  0x00d1,
+  0x00d2,
+  0x00d3,
+  0x00d4,
+  0x00d5,
+  0x00d6,
+  0x00d7,
+  0x00d2,
+  0x00d3,
+  0x00d8,
+  0x00d9,
+  0x00da,
+  0x00db,
+  0x00dc,
+  0x00dd,
+  0x00de,
+  0x00df,
+  0x00e0,
+  0x00e1,
+  0x00e2,
+  0x00e3,
+  0x00e4,
+  0x00e5,
+  0x00e6,
+  0x00e7,
+  0x00e8,
+  0x00e9,
+  0x00ea,
+  0x00eb,
+  0x00ec,
+  0x00ed,
+  0x00ee,
+  0x00ef,
+  0x00f0,
+  0x00f1,
+  0x00f2,
+  0x00f3,
+  0x00f4,
+  0x00f5,
+  0x00f6,
+  0x00f7,
+  0x00f8,
+  0x00f9,
+  0x00fa,
+  0x00fb,
+  0x00fc,
+  0x00fd,
+  0x00fe,
+  0x00ff,
+  0x0100,
+  0x0101,
+  0x0102,
+  0x0103,
+  0x0104,
+  0x0105,
+  0x0106,
+  0x0107,
+  0x0108,
+  0x0109,
+  0x010a,
+  0x010b,
+  0x010c,
+  0x010d,
+  0x010e,
+  0x010f,
+  0x0110,
+  0x0111,
+  0x0112,
+  0x0113,
+  0x0114,
+  0x0115,
+  0x0116,
+  0x0117,
+  0x0118,
+  0x0119,
+  0x011a,
+  0x011b,
+  0x011c,
+  0x011d,
+  0x011e,
+  0x011f,
+  0x0120,
+  0x0121,
+  0x0122,
+  0x0123,
+  0x0124,
+  0x0125,
+  0x0126,
+  0x0127,
+  0x0128,
+  0x0129,
+  0x012a,
+  0x012b,
+  0x012c,
+  0x012d,
+  0x012e,
+  0x012f,
+  0x0130,
+  0x0131,
+  0x0132,
+  0x0133,
+  0x0134,
+  0x0135,
+  0x0136,
+  0x0137,
+  0x0138,
+  0x0139,
+  0x013a,
+  0x013b,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x013c,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x013d,
+  0x013e,
+  0x013f,
+  0xffff,
+  0x0140,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0141,
+  0x0142,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0143,
+  0x0144,
+  0x0145,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x00c1,
+  0x00c2,
+  0x00e8,
+  0x00e9,
+  0x010a,
+  0x010b,
+  0x0128,
+  0x0129,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0146,
+  0x0147,
+  0x0148,
+  0x0149,
+  0x00da,
+  0x00db,
+  0x014a,
+  0x014b,
+  0x014c,
+  0x014d,
+  0x014e,
+  0x014f,
+  0x0150,
+  0x0151,
+  0x0152,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0153,
+  0x0154,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0155,
+  0x0156,
+  0x0157,
+  0x0158,
+  0x0159,
+  0x015a,
+  0x015b,
+  0x015c,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x015d,
+  0x015e,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x015f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0160,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0161,
+  0x0162,
+  0xffff,
+  0x0163,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0164,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0165,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0166,
+  0x0167,
+  0x0168,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0169,
+  0x016a,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x016a,
+  0x016b,
+  0xffff,
+  0x016c,
+  0x016d,
+  0x016e,
+  0x0041,
+  0x0073,
+  0x0169,
+  0x016d,
+  0x006e,
+  0x016f,
+  0x016a,
+  0x016b,
+  0x0067,
+  0xffff,
+  0x0170,
+  0x016e,
+  0x016a,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0171,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0172,
+  0x0173,
+  0x0174,
+  0x0175,
+  0x0176,
+  0x0177,
+  0x0178,
+  0xffff,
+  0x0179,
+  0xffff,
+  0x017a,
+  0x017b,
+  0x017c,
+  0x0022,
+  0x0023,
+  0x017d,
+  0x017e,
+  0x0026,
+  0x003b,
+  0x0029,
+  0x017f,
+  0x002a,
+  0x002c,
+  0x0180,
+  0x002e,
+  0x002f,
+  0x0181,
+  0x0030,
+  0x0182,
+  0x0031,
+  0xffff,
+  0x0183,
+  0x0035,
+  0x003a,
+  0x0184,
+  0x0039,
+  0x0185,
+  0x0186,
+  0x008e,
+  0x0134,
+  0x0187,
+  0x0188,
+  0x0189,
+  0x018a,
+  0x018b,
+  0x018c,
+  0x018d,
+  0x018e,
+  0x018f,
+  0x0163,
+  0x0190,
+  0x0142,
+  0x0191,
+  0x0192,
+  0x00f4,
+  0x0193,
+  0x0074,
+  0x0057,
+  0x0194,
+  0x0050,
+  0x0195,
+  0x0196,
+  0x0197,
+  0x0198,
+  0x0199,
+  0x019a,
+  0x019b,
+  0x019c,
+  0x019d,
+  0x019e,
+  0x019f,
+  0x01a0,
+  0x00b2,
+  0x01a1,
+  0x01a2,
+  0xffff,
+  0xffff,
+  0x01a3,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x01a4,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x01a5,
+  0x01a6,
+  0x0044,
+  0x004b,
+  0x01a7,
+  0x01a8,
+  0x01a9,
+  0x0087,
+  0x008a,
+  0x01aa,
+  0x01ab,
+  0x01ac,
+  0x0034,
+  0x002a,
+  0x008e,
+  0x002b,
+  0x01ad,
+  0x01ae,
+  0x01af,
+  0x01b0,
+  0x01b1,
+  0x01b2,
+  0x01b3,
+  0x0022,
+  0x01b4,
+  0x0023,
+  0x017d,
+  0x01b5,
+  0x0026,
+  0x01b6,
+  0x0014,
+  0x01b7,
+  0x01b8,
+  0x002c,
+  0x01b9,
+  0x002e,
+  0x0029,
+  0x0030,
+  0x0182,
+  0x0031,
+  0x0024,
+  0x0035,
+  0x01ba,
+  0x01bb,
+  0x0039,
+  0x01bc,
+  0x01bd,
+  0x01be,
+  0x01bf,
+  0x01c0,
+  0x01c1,
+  0x0043,
+  0x01c2,
+  0x01c3,
+  0x01c4,
+  0x0042,
+  0x01c5,
+  0x01c6,
+  0x01c7,
+  0x0048,
+  0x0046,
+  0x01c8,
+  0x01c9,
+  0x0056,
+  0x0129,
+  0x00f4,
+  0x01ca,
+  0x01cb,
+  0x01cc,
+  0x0050,
+  0x0195,
+  0x0051,
+  0x0044,
+  0x01cd,
+  0x005a,
+  0x01a4,
+  0x0059,
+  0x01ce,
+  0x01cf,
+  0x01d0,
+  0x01d1,
+  0x01d2,
+  0x01d3,
+  0x01d4,
+  0x01d5,
+  0x01d6,
+  0x01d7,
+  0x00a7,
+  0x00aa,
+  0x01d8,
+  0x01d9,
+  0x01da,
+  0x0054,
+  0x004a,
+  0x00ae,
+  0x004b,
+  0x01db,
+  0x01dc,
+  0x00e3,
+  0x01dd,
+  0x00b8,
+  0x01de,
+  0x01df,
+  0xffff,
+  0xffff,
+  0x01e0,
+  0x01e1,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x01e2,
+  0x01e3,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x01e4,
+  0x01e5,
+  0x01e6,
+  0x01e7,
+  0x01e8,
+  0x01e9,
+  0x01ea,
+  0x01eb,
+  0x01ec,
+  0x01ed,
+  0x01ee,
+  0x01ef,
+  0x01f0,
+  0x01f1,
+  0xffff,
+  0xffff,
+  0x01f2,
+  0x01f3,
+  0x01f4,
+  0x01f5,
+  0x01f6,
+  0x01f7,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x01f8,
+  0x01f9,
+  0xffff,
+  0xffff,
+  0x003a,
+  0x018e,
+  0x01fa,
+  0x01fb,
+  0x01fc,
+  0x01fd,
+  0xffff,
+  0xffff,
+  0x01fe,
+  0x01ff,
+  0x0200,
+  0x0201,
+  0x0202,
+  0x0203,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x002a,
+  0x0204,
+  0x0205,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x004d,
+  0x00c1,
+  0x00c2,
+  0x0083,
+  0x00a3,
+  0x0085,
+  0x00a5,
+  0x00d2,
+  0x00d3,
+  0x013e,
+  0x0162,
+  0x0206,
+  0x0207,
+  0x0208,
+  0x0209,
+  0x020a,
+  0x020b,
+  0xffff,
+  0xffff,
+  0x020c,
+  0x0127,
+  0x020d,
+  0x00bb,
+  0x0095,
+  0x00b5,
+  0x01a7,
+  0x020e,
+  0x020f,
+  0x0210,
+  0x0211,
+  0x0212,
+  0x0213,
+  0x015e,
+  0x0214,
+  0x00be,
+  0x0215,
+  0x0216,
+  0x0217,
+  0x0218,
+  0xffff,
+  0xffff,
+  0x0219,
+  0x021a,
+  0x021b,
+  0x021c,
+  0x021d,
+  0x021e,
+  0x021f,
+  0x0220,
+  0x0221,
+  0x0222,
+  0x0223,
+  0x0224,
+  0x0225,
+  0x0226,
+  0x0227,
+  0x0228,
+  0x0229,
+  0x022a,
+  0x022b,
+  0x022c,
+  0x022d,
+  0x022e,
+  0x022f,
+  0x0230,
+  0x0231,
+  0x0232,
+  0x0233,
+  0x0234,
+  0x0235,
+  0x0236,
+  0x0237,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0238,
+  0x0239,
+  0x023a,
+  0x023b,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x023c,
+  0x023d,
+  0x023e,
+  0x023f,
+  0x0240,
+  0x0241,
+  0x0242,
+  0x0243,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0244,
+  0x0245,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0246,
+  0x0247,
+  0xffff,
+  0xffff,
+  0x0248,
+  0x0249,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x024a,
+  0x024b,
+  0x024c,
+  0x024d,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x024e,
+  0x024f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0250,
+  0x0251,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x006c,
+  0x006c,
+  0x000e,
+  0x000e,
+  0x0252,
+  0x0252,
+  0x0253,
+  0x0254,
+  0x0255,
+  0x0256,
+  0x0257,
+  0x0258,
+  0x0259,
+  0x025a,
+  0x025b,
+  0x025c,
+  0x025d,
+  0x025e,
+  0x025f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0260,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0261,
+  0xffff,
+  0x0262,
+  0x0263,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0264,
+  0x0265,
+  0xffff,
+  0x0266,
+  0xffff,
+  0x016f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0267,
+  0x0268,
+  0xffff,
+  0xffff,
+  0x0269,
+  0x026a,
+  0x026b,
+  0x026c,
+  0x026d,
+  0x026e,
+  0x026f,
+  0x0270,
+  0x0271,
+  0x0272,
+  0x0273,
+  0x0274,
+  0x0275,
+  0x0276,
+  0x0277,
+  0x0278,
+  0x0279,
+  0x027a,
+  0x027b,
+  0x027c,
+  0x027d,
+  0x027e,
+  0x027f,
+  0x0280,
+  0x0281,
+  0x0282,
+  0x0283,
+  0xffff,
+  0x0284,
+  0x0285,
+  0x0286,
+  0x0287,
+  0x0288,
+  0x0289,
+  0x028a,
+  0x028b,
+  0x028c,
+  0xffff,
+  0x028d,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x028e,
+  0xffff,
+  0xffff,
+  0x028f,
+  0xffff,
+  0x0290,
+  0xffff,
+  0x0291,
+  0x0292,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0049,
+  0x00e3,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0293,
+  0x0294,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0295,
+  0xffff,
+  0xffff,
+  0x0296,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0297,
+  0xffff,
+  0x0298,
+  0xffff,
+  0x0186,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0299,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x029a,
+  0x029b,
+  0x029c,
+  0x029d,
+  0x029e,
+  0x029f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02a0,
+  0xffff,
+  0x02a1,
+  0xffff,
+  0x02a2,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02a3,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02a4,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02a5,
+  0x02a6,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02a7,
+  0x02a8,
+  0x02a9,
+  0x02aa,
+  0x02ab,
+  0x02ac,
+  0x02ad,
+  0xffff,
+  0xffff,
+  0x02ae,
+  0x02af,
+  0x02b0,
+  0x017e,
+  0x02b1,
+  0x02b2,
+  0x02b3,
+  0x02b4,
+  0x02b5,
+  0x02b6,
+  0x02b7,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x000e,
+  0x02b8,
+  0x02b9,
+  0x02ba,
+  0x02bb,
+  0xffff,
+  0xffff,
+  0x02bc,
+  0x02bd,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02be,
+  0x02bf,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0253,
+  0xffff,
+  0x02c0,
+  0x02c1,
+  0x02c2,
+  0x02c3,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02c4,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02c5,
+  0x02c6,
+  0xffff,
+  0xffff,
+  0x02c7,
+  0x02c8,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02c9,
+  0x02ca,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02cb,
+  0x02cc,
+  0xffff,
+  0xffff,
+  0x02cd,
+  0x02ce,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02cf,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02d0,
+  0x0036,
+  0x02b0,
+  0xffff,
+  0x02d1,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02d2,
+  0x02d3,
+  0x02d4,
+  0x02d5,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02d6,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02d7,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02d8,
+  0x02d9,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02da,
+  0x02db,
+  0x02dc,
+  0x02dd,
+  0x02de,
+  0x02df,
+  0x02e0,
+  0x02db,
+  0x02e1,
+  0x02e2,
+  0x02de,
+  0x02e3,
+  0x02e4,
+  0x02e5,
+  0x02e6,
+  0xffff,
+  0x02e7,
+  0x02e8,
+  0x02e9,
+  0x02ea,
+  0x02eb,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02ec,
+  0x02ed,
+  0x02ee,
+  0x02ef,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02ea,
+  0x02f0,
+  0x02f1,
+  0x02f2,
+  0x02f3,
+  0x02f4,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02f5,
+  0x02eb,
+  0x02f6,
+  0x02ea,
+  0x02f7,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02f8,
+  0x02f9,
+  0x02fa,
+  0x02fb,
+  0x02fc,
+  0x02fd,
+  0x02fe,
+  0x02ff,
+  0x0300,
+  0x0301,
+  0x0302,
+  0x0303,
+  0x0304,
+  0x0305,
+  0x0306,
+  0x0307,
+  0x0308,
+  0x0309,
+  0x030a,
+  0x030b,
+  0x030c,
+  0x030d,
+  0x030e,
+  0x030f,
+  0x0310,
+  0x0311,
+  0x0312,
+  0x0313,
+  0x0314,
+  0x0315,
+  0x0316,
+  0x0317,
+  0x0318,
+  0x0319,
+  0x031a,
+  0x031b,
+  0x031c,
+  0x031d,
+  0x031e,
+  0x031f,
+  0x0320,
+  0x0321,
+  0x0322,
+  0x0323,
+  0x0324,
+  0x0325,
+  0x0326,
+  0x0327,
+  0x0328,
+  0x0329,
+  0x032a,
+  0x032b,
+  0x032c,
+  0x032d,
+  0x032e,
+  0x032f,
+  0x0330,
+  0x0331,
+  0x0332,
+  0x0333,
+  0x0334,
+  0x0335,
+  0x0336,
+  0x0337,
+  0x0338,
+  0x0339,
+  0x033a,
+  0x033b,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x033c,
+  0x033d,
+  0x033e,
+  0x033f,
+  0x0340,
+  0x0341,
+  0x0342,
+  0x0343,
+  0x0344,
+  0x0345,
+  0x0346,
+  0x0347,
+  0x0348,
+  0x0349,
+  0x034a,
+  0x034b,
+  0x034c,
+  0x034d,
+  0x034e,
+  0x034f,
+  0x0350,
+  0x0351,
+  0x0352,
+  0x0353,
+  0x0354,
+  0x0355,
+  0x0356,
+  0x0357,
+  0x0358,
+  0x0359,
+  0x035a,
+  0x035b,
+  0x035c,
+  0x035d,
+  0x035e,
+  0x035f,
+  0x0360,
+  0x0361,
+  0x0362,
+  0x0363,
+  0x0364,
+  0x0365,
+  0x0366,
+  0x0367,
+  0x0368,
+  0x0369,
+  0x036a,
+  0x036b,
+  0x036c,
+  0x036d,
+  0x036e,
+  0x036f,
+  0x0370,
+  0x0371,
+  0x0372,
+  0x0373,
+  0x0374,
+  0x0375,
+  0x0376,
+  0x0377,
+  0x0378,
+  0x0379,
+  0x037a,
+  0x037b,
+  0x037c,
+  0x037d,
+  0x037e,
+  0x037f,
+  0xffff,
+  0xffff,
+  0x0380,
+  0x0381,
+  0x0382,
+  0x0383,
+  0x0384,
+  0x0385,
+  0x0386,
+  0x0387,
+  0x0388,
+  0x0389,
+  0x038a,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x038b,
+  0xffff,
+  0x038c,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x038d,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x038e,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x038e,
+  0xffff,
+  0x038f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0390,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0390,
+  0xffff,
+  0x0391,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0392,
+  0x0393,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x025f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0394,
+  0x0395,
+  0x0396,
+  0x0397,
+  0x0398,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0399,
+  0xffff,
+  0x039a,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x039b,
+  0xffff,
+  0xffff,
+  0x039c,
+  0xffff,
+  0x039d,
+  0x0391,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x039e,
+  0x039f,
+  0x03a0,
+  0x03a1,
+  0xffff,
+  0xffff,
+  0x03a2,
+  0x03a3,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x03a4,
+  0x03a5,
+  0x03a6,
+  0x03a7,
+  0x0001,
+  0x03a8,
+  0x03a9,
+  0x03aa,
+  0x03ab,
+  0x03ac,
+  0x03ad,
+  0x03ae,
+  0x03af,
+  0x03b0,
+  0x03b1,
+  0x03b2,
+  0x03b3,
+  0x03b4,
+  0x03b5,
+  0x03b6,
+  0x03b7,
+  0x03b8,
+  0x03b9,
+  0x03ba,
+  0x03bb,
+  0x03bc,
+  0x03bd,
+  0x03be,
+  0x03bf,
+  0x03c0,
+  0x03c1,
+  0x03c2,
+  0x03c3,
+  0x03c4,
+  0x03c5,
+  0x03c6,
+  0x03c7,
+  0x03c8,
+  0x03c9,
+  0x03ca,
+  0x03cb,
+  0x03cc,
+  0x03cd,
+  0x03ce,
+  0x03cf,
+  0x03d0,
+  0x03d1,
+  0x03d2,
+  0x03d3,
+  0x03d4,
+  0x03d5,
+  0x03d6,
+  0x03d7,
+  0x03d8,
+  0x03d9,
+  0x03da,
+  0x03db,
+  0x03dc,
+  0x03dd,
+  0x03de,
+  0x03df,
+  0x03e0,
+  0x03e1,
+  0x03e2,
+  0x03e3,
+  0x03e4,
+  0x03e5,
+  0x03e6,
+  0x03e7,
+  0x03e8,
+  0x03e9,
+  0x03ea,
+  0x03eb,
+  0x03ec,
+  0x03ed,
+  0x03ee,
+  0x03ef,
+  0x03f0,
+  0x03f1,
+  0x03f2,
+  0x03f3,
+  0x03f4,
+  0x03f5,
+  0x03f6,
+  0x03f7,
+  0x03f8,
+  0x03f9,
+  0x03fa,
+  0x03fb,
+  0x03fc,
+  0x03fd,
+  0x03fe,
+  0x03ff,
+  0x0400,
+  0x0401,
+  0x0402,
+  0x0403,
+  0x0404,
+  0x0405,
+  0x0406,
+  0x0407,
+  0x0408,
+  0x0409,
+  0x040a,
+  0x040b,
+  0x040c,
+  0x040d,
+  0x040e,
+  0x040f,
+  0x0410,
+  0x0411,
+  0x0412,
+  0x0413,
+  0x0414,
+  0x0415,
+  0x0416,
+  0x0417,
+  0x0418,
+  0x0419,
+  0x041a,
+  0x041b,
+  0x041c,
+  0x041d,
+  0x041e,
+  0x041f,
+  0x0420,
+  0x0421,
+  0x0422,
+  0x0423,
+  0x0424,
+  0x0425,
+  0x0426,
+  0x0427,
+  0x0428,
+  0x0429,
+  0x042a,
+  0x042b,
+  0x042c,
+  0x042d,
+  0x042e,
+  0x042f,
+  0x0430,
+  0x0431,
+  0x0432,
+  0x0433,
+  0x0434,
+  0x0435,
+  0x0436,
+  0x0437,
+  0x0438,
+  0x0439,
+  0x043a,
+  0x043b,
+  0x043c,
+  0x043d,
+  0x043e,
+  0x043f,
+  0x0440,
+  0x0441,
+  0x0442,
+  0x0443,
+  0x0444,
+  0x0445,
+  0x0446,
+  0x0447,
+  0x0448,
+  0x0449,
+  0x044a,
+  0x044b,
+  0x044c,
+  0x044d,
+  0x044e,
+  0x044f,
+  0x0450,
+  0x0451,
+  0x0452,
+  0x0453,
+  0x0454,
+  0x0455,
+  0x0456,
+  0x0457,
+  0x0458,
+  0x0459,
+  0x045a,
+  0x045b,
+  0x045c,
+  0x045d,
+  0x045e,
+  0x045f,
+  0x0460,
+  0x0461,
+  0x0462,
+  0x0463,
+  0x0464,
+  0x0465,
+  0x0466,
+  0x0467,
+  0x0468,
+  0x0469,
+  0x046a,
+  0x046b,
+  0x046c,
+  0x046d,
+  0x046e,
+  0x046f,
+  0x0470,
+  0x0471,
+  0x0472,
+  0x0473,
+  0x0474,
+  0x0475,
+  0x0476,
+  0x0477,
+  0x0478,
+  0x0479,
+  0x047a,
+  0x047b,
+  0x047c,
+  0x047d,
+  0x047e,
+  0x047f,
+  0x0480,
+  0x0481,
+  0x0482,
+  0x0483,
+  0x0484,
+  0x0485,
+  0x0486,
+  0x0487,
+  0x0488,
+  0x0489,
+  0x048a,
+  0x048b,
+  0x048c,
+  0x048d,
+  0x048e,
+  0x048f,
+  0x0490,
+  0x0491,
+  0x0492,
+  0x0493,
+  0x0494,
+  0x0495,
+  0x0496,
+  0x0497,
+  0x0498,
+  0x0499,
+  0x049a,
+  0x049b,
+  0x049c,
+  0x049d,
+  0x049e,
+  0x049f,
+  0x04a0,
+  0x04a1,
+  0x04a2,
+  0x04a3,
+  0x04a4,
+  0x04a5,
+  0x04a6,
+  0x04a7,
+  0x04a8,
+  0x04a9,
+  0x04aa,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x04ab,
+  0x04ac,
+  0x04ad,
+  0x04ae,
+  0x015f,
+  0x04af,
+};
+
+static const struct bitmap_font_page bold_font_pages[256] = {
+  {0, 0x00, 0xff},
+  {256, 0x00, 0xff},
+  {512, 0x18, 0xdd},
+  {710, 0x00, 0xf6},
+  {957, 0x00, 0xf9},
+  {1207, 0xd0, 0xea},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {1234, 0x0c, 0xf9},
+  {0, 0xff, 0x00},
+  {1472, 0x00, 0xae},
+  {1647, 0x02, 0xd5},
+  {1859, 0x00, 0xc3},
+  {2055, 0x00, 0xd0},
+  {2264, 0x09, 0x24},
+  {2292, 0x00, 0xd9},
+  {2510, 0x3a, 0x6b},
+  {2560, 0x13, 0xeb},
+  {2777, 0x00, 0xff},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {3033, 0x2c, 0x2c},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {3034, 0xa0, 0xb3},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {3054, 0xbe, 0xbe},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {0, 0xff, 0x00},
+  {3055, 0xfd, 0xfd},
+};
+
+static const uint16_t bold_font_page_glyphs[3056] = {
+  0x0000,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0001,
+  0x0002,
+  0x0003,
+  0x0004,
+  0x0005,
+  0x0006,
+  0x0007,
+  0x0008,
+  0x0009,
+  0x000a,
+  0x000b,
+  0x000c,
+  0x000d,
+  0x000e,
+  0x000f,
+  0x0010,
+  0x0011,
+  0x0012,
+  0x0013,
+  0x0014,
+  0x0015,
+  0x0016,
+  0x0017,
+  0x0018,
+  0x0019,
+  0x001a,
+  0x001b,
+  0x001c,
+  0x001d,
+  0x001e,
+  0x001f,
+  0x0020,
+  0x0021,
+  0x0022,
+  0x0023,
+  0x0024,
+  0x0025,
+  0x0026,
+  0x0027,
+  0x0028,
+  0x0029,
+  0x002a,
+  0x002b,
+  0x002c,
+  0x002d,
+  0x002e,
+  0x002f,
+  0x0030,
+  0x0031,
+  0x0032,
+  0x0033,
+  0x0034,
+  0x0035,
+  0x0036,
+  0x0037,
+  0x0038,
+  0x0039,
+  0x003a,
+  0x003b,
+  0x003c,
+  0x003d,
+  0x003e,
+  0x003f,
+  0x0040,
+  0x0041,
+  0x0042,
+  0x0043,
+  0x0044,
+  0x0045,
+  0x0046,
+  0x0047,
+  0x0048,
+  0x0049,
+  0x004a,
+  0x004b,
+  0x004c,
+  0x004d,
+  0x004e,
+  0x004f,
+  0x0050,
+  0x0051,
+  0x0052,
+  0x0053,
+  0x0054,
+  0x0055,
+  0x0056,
+  0x0057,
+  0x0058,
+  0x0059,
+  0x005a,
+  0x005b,
+  0x005c,
+  0x005d,
+  0x005e,
+  0x005f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0001,
+  0x0060,
+  0x0061,
+  0x0062,
+  0x0063,
+  0x0064,
+  0x0065,
+  0x0066,
+  0x0067,
+  0x0068,
+  0x0069,
+  0x006a,
+  0x006b,
+  0x006c,
+  0x006d,
+  0x006e,
+  0x006f,
+  0x0070,
+  0x0071,
+  0x0072,
+  0x0073,
+  0x0074,
+  0x0075,
+  0x0076,
+  0x0077,
+  0x0078,
+  0x0079,
+  0x007a,
+  0x007b,
+  0x007c,
+  0x007d,
+  0x007e,
+  0x007f,
+  0x0080,
+  0x0081,
+  0x0082,
+  0x0083,
+  0x0084,
+  0x0085,
+  0x0086,
+  0x0087,
+  0x0088,
+  0x0089,
+  0x008a,
+  0x008b,
+  0x008c,
+  0x008d,
+  0x008e,
+  0x008f,
+  0x0090,
+  0x0091,
+  0x0092,
+  0x0093,
+  0x0094,
+  0x0095,
+  0x0096,
+  0x0097,
+  0x0098,
+  0x0099,
+  0x009a,
+  0x009b,
+  0x009c,
+  0x009d,
+  0x009e,
+  0x009f,
+  0x00a0,
+  0x00a1,
+  0x00a2,
+  0x00a3,
+  0x00a4,
+  0x00a5,
+  0x00a6,
+  0x00a7,
+  0x00a8,
+  0x00a9,
+  0x00aa,
+  0x00ab,
+  0x00ac,
+  0x00ad,
+  0x00ae,
+  0x00af,
+  0x00b0,
+  0x00b1,
+  0x00b2,
+  0x00b3,
+  0x00b4,
+  0x00b5,
+  0x00b6,
+  0x00b7,
+  0x00b8,
+  0x00b9,
+  0x00ba,
+  0x00bb,
+  0x00bc,
+  0x00bd,
+  0x00be,
+  0x00bf,
+  0x00c0,
+  0x00c1,
+  0x00c2,
+  0x00c3,
+  0x00c4,
+  0x00c5,
+  0x00c6,
+  0x00c7,
+  0x00c8,
+  0x00c9,
+  0x00ca,
+  0x00cb,
+  0x00cc,
+  0x00cd,
+  0x00ce,
+  0x008f,
+  0x00cf,
+  0x00d0,
+  0x00d1,
+  0x00d2,
+  0x00d3,
+  0x00d4,
+  0x00d5,
+  0x00d6,
+  0x00d7,
+  0x00d2,
+  0x00d3,
+  0x00d8,
+  0x00d9,
+  0x00da,
+  0x00db,
+  0x00dc,
+  0x00dd,
+  0x00de,
+  0x00df,
+  0x00e0,
+  0x00e1,
+  0x00e2,
+  0x00e3,
+  0x00e4,
+  0x00e5,
+  0x00e6,
+  0x00e7,
+  0x00e8,
+  0x00e9,
+  0x00ea,
+  0x00eb,
+  0x00ec,
+  0x00ed,
+  0x00ee,
+  0x00ef,
+  0x00f0,
+  0x00f1,
+  0x00f2,
+  0x00f3,
+  0x00f4,
+  0x00f5,
+  0x00f6,
+  0x00f7,
+  0x00f8,
+  0x00f9,
+  0x00fa,
+  0x00fb,
+  0x00fc,
+  0x00fd,
+  0x00fe,
+  0x00ff,
+  0x0100,
+  0x0101,
+  0x0102,
+  0x0103,
+  0x0104,
+  0x0105,
+  0x0106,
+  0x0107,
+  0x0108,
+  0x0109,
+  0x010a,
+  0x010b,
+  0x010c,
+  0x010d,
+  0x010e,
+  0x010f,
+  0x0110,
+  0x0111,
+  0x0112,
+  0x0113,
+  0x0114,
+  0x0115,
+  0x0116,
+  0x0117,
+  0x0118,
+  0x0119,
+  0x011a,
+  0x011b,
+  0x011c,
+  0x011d,
+  0x011e,
+  0x011f,
+  0x0120,
+  0x0121,
+  0x0122,
+  0x0123,
+  0x0124,
+  0x0125,
+  0x0126,
+  0x0127,
+  0x0128,
+  0x0129,
+  0x012a,
+  0x012b,
+  0x012c,
+  0x012d,
+  0x012e,
+  0x012f,
+  0x0130,
+  0x0131,
+  0x0132,
+  0x0133,
+  0x0134,
+  0x0135,
+  0x0136,
+  0x0137,
+  0x0138,
+  0x0139,
+  0x013a,
+  0x013b,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x013c,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x013d,
+  0x013e,
+  0x013f,
+  0xffff,
+  0x0140,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0141,
+  0x0142,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0143,
+  0x0144,
+  0x0145,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x00c1,
+  0x00c2,
+  0x00e8,
+  0x00e9,
+  0x010a,
+  0x010b,
+  0x0128,
+  0x0129,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0146,
+  0x0147,
+  0x0148,
+  0x0149,
+  0x00da,
+  0x00db,
+  0x014a,
+  0x014b,
+  0x014c,
+  0x014d,
+  0x014e,
+  0x014f,
+  0x0150,
+  0x0151,
+  0x0152,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0153,
+  0x0154,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0155,
+  0x0156,
+  0x0157,
+  0x0158,
+  0x0159,
+  0x015a,
+  0x015b,
+  0x015c,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x015d,
+  0x015e,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x015f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0160,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0161,
+  0x0162,
+  0xffff,
+  0x0163,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0164,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0165,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0166,
+  0x0167,
+  0x0168,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0169,
+  0x016a,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x016a,
+  0x016b,
+  0xffff,
+  0x016c,
+  0x016d,
+  0x016e,
+  0x0041,
+  0x0073,
+  0x0169,
+  0x016d,
+  0x006e,
+  0x016f,
+  0x016a,
+  0x016b,
+  0x0067,
+  0xffff,
+  0x0170,
+  0x016e,
+  0x016a,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0171,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0172,
+  0x0173,
+  0x0174,
+  0x0175,
+  0x0176,
+  0x0177,
+  0x0178,
+  0xffff,
+  0x0179,
+  0xffff,
+  0x017a,
+  0x017b,
+  0x017c,
+  0x0022,
+  0x0023,
+  0x017d,
+  0x017e,
+  0x0026,
+  0x003b,
+  0x0029,
+  0x017f,
+  0x002a,
+  0x002c,
+  0x0180,
+  0x002e,
+  0x002f,
+  0x0181,
+  0x0030,
+  0x0182,
+  0x0031,
+  0xffff,
+  0x0183,
+  0x0035,
+  0x003a,
+  0x0184,
+  0x0039,
+  0x0185,
+  0x0186,
+  0x008e,
+  0x0134,
+  0x0187,
+  0x0188,
+  0x0189,
+  0x018a,
+  0x018b,
+  0x018c,
+  0x018d,
+  0x018e,
+  0x018f,
+  0x0163,
+  0x0190,
+  0x0142,
+  0x0191,
+  0x0192,
+  0x00f4,
+  0x0193,
+  0x0074,
+  0x0057,
+  0x0194,
+  0x0050,
+  0x0195,
+  0x0196,
+  0x0197,
+  0x0198,
+  0x0199,
+  0x019a,
+  0x019b,
+  0x019c,
+  0x019d,
+  0x019e,
+  0x019f,
+  0x01a0,
+  0x00b2,
+  0x01a1,
+  0x01a2,
+  0xffff,
+  0xffff,
+  0x01a3,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x01a4,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x01a5,
+  0x01a6,
+  0x0044,
+  0x004b,
+  0x01a7,
+  0x01a8,
+  0x01a9,
+  0x0087,
+  0x008a,
+  0x01aa,
+  0x01ab,
+  0x01ac,
+  0x0034,
+  0x002a,
+  0x008e,
+  0x002b,
+  0x01ad,
+  0x01ae,
+  0x01af,
+  0x01b0,
+  0x01b1,
+  0x01b2,
+  0x01b3,
+  0x0022,
+  0x01b4,
+  0x0023,
+  0x017d,
+  0x01b5,
+  0x0026,
+  0x01b6,
+  0x0014,
+  0x01b7,
+  0x01b8,
+  0x002c,
+  0x01b9,
+  0x002e,
+  0x0029,
+  0x0030,
+  0x0182,
+  0x0031,
+  0x0024,
+  0x0035,
+  0x01ba,
+  0x01bb,
+  0x0039,
+  0x01bc,
+  0x01bd,
+  0x01be,
+  0x01bf,
+  0x01c0,
+  0x01c1,
+  0x01c2,
+  0x01c3,
+  0x01c4,
+  0x01c5,
+  0x0042,
+  0x01c6,
+  0x01c7,
+  0x01c8,
+  0x0048,
+  0x0046,
+  0x01c9,
+  0x01ca,
+  0x0056,
+  0x0129,
+  0x00f4,
+  0x01cb,
+  0x01cc,
+  0x01cd,
+  0x0050,
+  0x0195,
+  0x0051,
+  0x0044,
+  0x01ce,
+  0x005a,
+  0x01a4,
+  0x0059,
+  0x01cf,
+  0x01d0,
+  0x01d1,
+  0x01d2,
+  0x01d3,
+  0x01d4,
+  0x01d5,
+  0x01d6,
+  0x01d7,
+  0x01d8,
+  0x00a7,
+  0x00aa,
+  0x01d9,
+  0x01da,
+  0x01db,
+  0x0054,
+  0x004a,
+  0x00ae,
+  0x004b,
+  0x01dc,
+  0x01dd,
+  0x00e3,
+  0x01de,
+  0x00b8,
+  0x01df,
+  0x01e0,
+  0xffff,
+  0xffff,
+  0x01e1,
+  0x01e2,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x01e3,
+  0x01e4,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x01e5,
+  0x01e6,
+  0x01e7,
+  0x01e8,
+  0x01e9,
+  0x01ea,
+  0x01eb,
+  0x01ec,
+  0x01ed,
+  0x01ee,
+  0x01ef,
+  0x01f0,
+  0x01f1,
+  0x01f2,
+  0xffff,
+  0xffff,
+  0x01f3,
+  0x01f4,
+  0x01f5,
+  0x01f6,
+  0x01f7,
+  0x01f8,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x01f9,
+  0x01fa,
+  0xffff,
+  0xffff,
+  0x003a,
+  0x018e,
+  0x01fb,
+  0x01fc,
+  0x01fd,
+  0x01fe,
+  0xffff,
+  0xffff,
+  0x01ff,
+  0x0200,
+  0x0201,
+  0x0202,
+  0x0203,
+  0x0204,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x002a,
+  0x0205,
+  0x0206,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x004d,
+  0x00c1,
+  0x00c2,
+  0x0083,
+  0x00a3,
+  0x0085,
+  0x00a5,
+  0x00d2,
+  0x00d3,
+  0x013e,
+  0x0162,
+  0x0207,
+  0x0208,
+  0x0209,
+  0x020a,
+  0x020b,
+  0x020c,
+  0xffff,
+  0xffff,
+  0x020d,
+  0x0127,
+  0x020e,
+  0x00bb,
+  0x0095,
+  0x00b5,
+  0x01a7,
+  0x020f,
+  0x0210,
+  0x0211,
+  0x0212,
+  0x0213,
+  0x0214,
+  0x015e,
+  0x0215,
+  0x00be,
+  0x0216,
+  0x0217,
+  0x0218,
+  0x0219,
+  0xffff,
+  0xffff,
+  0x021a,
+  0x021b,
+  0x021c,
+  0x021d,
+  0x021e,
+  0x021f,
+  0x0220,
+  0x0221,
+  0x0222,
+  0x0223,
+  0x0224,
+  0x0225,
+  0x0226,
+  0x0227,
+  0x0228,
+  0x0229,
+  0x022a,
+  0x022b,
+  0x022c,
+  0x022d,
+  0x022e,
+  0x022f,
+  0x0230,
+  0x0231,
+  0x0232,
+  0x0233,
+  0x0234,
+  0x0235,
+  0x0236,
+  0x0237,
+  0x0238,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0239,
+  0x023a,
+  0x023b,
+  0x023c,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x023d,
+  0x023e,
+  0x023f,
+  0x0240,
+  0x0241,
+  0x0242,
+  0x0243,
+  0x0244,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0245,
+  0x0246,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0247,
+  0x0248,
+  0xffff,
+  0xffff,
+  0x0249,
+  0x024a,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x024b,
+  0x024c,
+  0x024d,
+  0x024e,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x024f,
+  0x0250,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0251,
+  0x0252,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x0001,
+  0x006c,
+  0x006c,
+  0x000e,
+  0x000e,
+  0x000e,
+  0x000e,
+  0x0253,
+  0x0254,
+  0x0255,
+  0x0256,
+  0x000d,
+  0x0257,
+  0x0258,
+  0x0259,
+  0x025a,
+  0x025b,
+  0x025c,
+  0x025d,
+  0x025e,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x025f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0260,
+  0xffff,
+  0x0261,
+  0x0262,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0263,
+  0x0264,
+  0xffff,
+  0x0265,
+  0xffff,
+  0x016f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0266,
+  0x0267,
+  0xffff,
+  0xffff,
+  0x0268,
+  0x0269,
+  0x026a,
+  0x026b,
+  0x026c,
+  0x026d,
+  0x026e,
+  0x026f,
+  0x0270,
+  0x0271,
+  0x0272,
+  0x0273,
+  0x0274,
+  0x0275,
+  0x0276,
+  0x0277,
+  0x0278,
+  0x0279,
+  0x027a,
+  0x027b,
+  0x027c,
+  0x027d,
+  0x027e,
+  0x027f,
+  0x0280,
+  0x0281,
+  0x0282,
+  0xffff,
+  0x0283,
+  0x0284,
+  0x0285,
+  0x0286,
+  0x0287,
+  0x0288,
+  0x0289,
+  0x028a,
+  0x028b,
+  0xffff,
+  0x028c,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x028d,
+  0xffff,
+  0xffff,
+  0x028e,
+  0xffff,
+  0x028f,
+  0xffff,
+  0x0290,
+  0x0291,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0049,
+  0x00e3,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0292,
+  0x0293,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0294,
+  0xffff,
+  0xffff,
+  0x0295,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0296,
+  0xffff,
+  0x0297,
+  0xffff,
+  0x0186,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0298,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0299,
+  0x029a,
+  0x029b,
+  0x029c,
+  0x029d,
+  0x029e,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x029f,
+  0xffff,
+  0x02a0,
+  0xffff,
+  0x02a1,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02a2,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02a3,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02a4,
+  0x02a5,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02a6,
+  0x02a7,
+  0x02a8,
+  0x02a9,
+  0x02aa,
+  0x02ab,
+  0x02ac,
+  0xffff,
+  0xffff,
+  0x02ad,
+  0x02ae,
+  0x02af,
+  0x017e,
+  0x02b0,
+  0x02b1,
+  0x02b2,
+  0x02b3,
+  0x02b4,
+  0x02b5,
+  0x02b6,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x000e,
+  0x02b7,
+  0x02b8,
+  0x02b9,
+  0x02ba,
+  0xffff,
+  0xffff,
+  0x02bb,
+  0x02bc,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02bd,
+  0x02be,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0253,
+  0xffff,
+  0x02bf,
+  0x02c0,
+  0x02c1,
+  0x02c2,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02c3,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02c4,
+  0x02c5,
+  0xffff,
+  0xffff,
+  0x02c6,
+  0x02c7,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02c8,
+  0x02c9,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02ca,
+  0x02cb,
+  0xffff,
+  0xffff,
+  0x02cc,
+  0x02cd,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02ce,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02cf,
+  0x0036,
+  0x02af,
+  0xffff,
+  0x02d0,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02d1,
+  0x02d2,
+  0x02d3,
+  0x02d4,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02d5,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02d6,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02d7,
+  0x02d8,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02d9,
+  0x02da,
+  0x02db,
+  0x02dc,
+  0x02dd,
+  0x02de,
+  0x02df,
+  0x02da,
+  0x02e0,
+  0x02e1,
+  0x02dd,
+  0x02e2,
+  0x02e3,
+  0x02e4,
+  0x02e5,
+  0xffff,
+  0x02e6,
+  0x02e7,
+  0x02e8,
+  0x02e9,
+  0x02ea,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02eb,
+  0x02ec,
+  0x02ed,
+  0x02ee,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02e9,
+  0x02ef,
+  0x02f0,
+  0x02f1,
+  0x02f2,
+  0x02f3,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02f4,
+  0x02ea,
+  0x02f5,
+  0x02e9,
+  0x02f6,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x02f7,
+  0x02f8,
+  0x02f9,
+  0x02fa,
+  0x02fb,
+  0x02fc,
+  0x02fd,
+  0x02fe,
+  0x02ff,
+  0x0300,
+  0x0301,
+  0x0302,
+  0x0303,
+  0x0304,
+  0x0305,
+  0x0306,
+  0x0307,
+  0x0308,
+  0x0309,
+  0x030a,
+  0x030b,
+  0x030c,
+  0x030d,
+  0x030e,
+  0x030f,
+  0x0310,
+  0x0311,
+  0x0312,
+  0x0313,
+  0x0314,
+  0x0315,
+  0x0316,
+  0x0317,
+  0x0318,
+  0x0319,
+  0x031a,
+  0x031b,
+  0x031c,
+  0x031d,
+  0x031e,
+  0x031f,
+  0x0320,
+  0x0321,
+  0x0322,
+  0x0323,
+  0x0324,
+  0x0325,
+  0x0326,
+  0x0327,
+  0x0328,
+  0x0329,
+  0x032a,
+  0x032b,
+  0x032c,
+  0x032d,
+  0x032e,
+  0x032f,
+  0x0330,
+  0x0331,
+  0x0332,
+  0x0333,
+  0x0334,
+  0x0335,
+  0x0336,
+  0x0337,
+  0x0338,
+  0x0339,
+  0x033a,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x033b,
+  0x033c,
+  0x033d,
+  0x033e,
+  0x033f,
+  0x0340,
+  0x0341,
+  0x0342,
+  0x0343,
+  0x0344,
+  0x0345,
+  0x0346,
+  0x0347,
+  0x0348,
+  0x0349,
+  0x034a,
+  0x034b,
+  0x034c,
+  0x034d,
+  0x034e,
+  0x034f,
+  0x0350,
+  0x0351,
+  0x0352,
+  0x0353,
+  0x0354,
+  0x0355,
+  0x0356,
+  0x0357,
+  0x0358,
+  0x0359,
+  0x035a,
+  0x035b,
+  0x035c,
+  0x035d,
+  0x035e,
+  0x035f,
+  0x0360,
+  0x0361,
+  0x0362,
+  0x0363,
+  0x0364,
+  0x0365,
+  0x0366,
+  0x0367,
+  0x0368,
+  0x0369,
+  0x036a,
+  0x036b,
+  0x02ee,
+  0x036c,
+  0x036d,
+  0x036e,
+  0x036f,
+  0x0370,
+  0x0371,
+  0x0372,
+  0x0373,
+  0x0374,
+  0x0375,
+  0x0376,
+  0x0377,
+  0x0378,
+  0x0379,
+  0x037a,
+  0x037b,
+  0x037c,
+  0x037d,
+  0xffff,
+  0xffff,
+  0x037e,
+  0x037f,
+  0x0380,
+  0x0381,
+  0x0382,
+  0x0383,
+  0x0384,
+  0x0385,
+  0x0386,
+  0x0387,
+  0x0388,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0389,
+  0xffff,
+  0x038a,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x038b,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x038c,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x038c,
+  0xffff,
+  0x038d,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x038e,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x038e,
+  0xffff,
+  0x038f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0390,
+  0x0391,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0392,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0393,
+  0x0394,
+  0x0395,
+  0x0396,
+  0x0397,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x0398,
+  0xffff,
+  0x0399,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x039a,
+  0xffff,
+  0xffff,
+  0x039b,
+  0xffff,
+  0x039c,
+  0x038f,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x039d,
+  0x039e,
+  0x039f,
+  0x03a0,
+  0xffff,
+  0xffff,
+  0x03a1,
+  0x03a2,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x03a3,
+  0x03a4,
+  0x03a5,
+  0x03a6,
+  0x0001,
+  0x03a7,
+  0x03a8,
+  0x03a9,
+  0x03aa,
+  0x03ab,
+  0x03ac,
+  0x03ad,
+  0x03ae,
+  0x03af,
+  0x03b0,
+  0x03b1,
+  0x03b2,
+  0x03b3,
+  0x03b4,
+  0x03b5,
+  0x03b6,
+  0x03b7,
+  0x03b8,
+  0x03b9,
+  0x03ba,
+  0x03bb,
+  0x03bc,
+  0x03bd,
+  0x03be,
+  0x03bf,
+  0x03c0,
+  0x03c1,
+  0x03c2,
+  0x03c3,
+  0x03c4,
+  0x03c5,
+  0x03c6,
+  0x03c7,
+  0x03c8,
+  0x03c9,
+  0x03ca,
+  0x03cb,
+  0x03cc,
+  0x03cd,
+  0x03ce,
+  0x03cf,
+  0x03d0,
+  0x03d1,
+  0x03d2,
+  0x03d3,
+  0x03d4,
+  0x03d5,
+  0x03d6,
+  0x03d7,
+  0x03d8,
+  0x03d9,
+  0x03da,
+  0x03db,
+  0x03dc,
+  0x03dd,
+  0x03de,
+  0x03df,
+  0x03e0,
+  0x03e1,
+  0x03e2,
+  0x03e3,
+  0x03e4,
+  0x03e5,
+  0x03e6,
+  0x03e7,
+  0x03e8,
+  0x03e9,
+  0x03ea,
+  0x03eb,
+  0x03ec,
+  0x03ed,
+  0x03ee,
+  0x03ef,
+  0x03f0,
+  0x03f1,
+  0x03f2,
+  0x03f3,
+  0x03f4,
+  0x03f5,
+  0x03f6,
+  0x03f7,
+  0x03f8,
+  0x03f9,
+  0x03fa,
+  0x03fb,
+  0x03fc,
+  0x03fd,
+  0x03fe,
+  0x03ff,
+  0x0400,
+  0x0401,
+  0x0402,
+  0x0403,
+  0x0404,
+  0x0405,
+  0x0406,
+  0x0407,
+  0x0408,
+  0x0409,
+  0x040a,
+  0x040b,
+  0x040c,
+  0x040d,
+  0x040e,
+  0x040f,
+  0x0410,
+  0x0411,
+  0x0412,
+  0x0413,
+  0x0414,
+  0x0415,
+  0x0416,
+  0x0417,
+  0x0418,
+  0x0419,
+  0x041a,
+  0x041b,
+  0x041c,
+  0x041d,
+  0x041e,
+  0x041f,
+  0x0420,
+  0x0421,
+  0x0422,
+  0x0423,
+  0x0424,
+  0x0425,
+  0x0426,
+  0x0427,
+  0x0428,
+  0x0429,
+  0x042a,
+  0x042b,
+  0x042c,
+  0x042d,
+  0x042e,
+  0x042f,
+  0x0430,
+  0x0431,
+  0x0432,
+  0x0433,
+  0x0434,
+  0x0435,
+  0x0436,
+  0x0437,
+  0x0438,
+  0x0439,
+  0x043a,
+  0x043b,
+  0x043c,
+  0x043d,
+  0x043e,
+  0x043f,
+  0x0440,
+  0x0441,
+  0x0442,
+  0x0443,
+  0x0444,
+  0x0445,
+  0x0446,
+  0x0447,
+  0x0448,
+  0x0449,
+  0x044a,
+  0x044b,
+  0x044c,
+  0x044d,
+  0x044e,
+  0x044f,
+  0x0450,
+  0x0451,
+  0x0452,
+  0x0453,
+  0x0454,
+  0x0455,
+  0x0456,
+  0x0457,
+  0x0458,
+  0x0459,
+  0x045a,
+  0x045b,
+  0x045c,
+  0x045d,
+  0x045e,
+  0x045f,
+  0x0460,
+  0x0461,
+  0x0462,
+  0x0463,
+  0x0464,
+  0x0465,
+  0x0466,
+  0x0467,
+  0x0468,
+  0x0469,
+  0x046a,
+  0x046b,
+  0x046c,
+  0x046d,
+  0x046e,
+  0x046f,
+  0x0470,
+  0x0471,
+  0x0472,
+  0x0473,
+  0x0474,
+  0x0475,
+  0x0476,
+  0x0477,
+  0x0478,
+  0x0479,
+  0x047a,
+  0x047b,
+  0x047c,
+  0x047d,
+  0x047e,
+  0x047f,
+  0x0480,
+  0x0481,
+  0x0482,
+  0x0483,
+  0x0484,
+  0x0485,
+  0x0486,
+  0x0487,
+  0x0488,
+  0x0489,
+  0x048a,
+  0x048b,
+  0x048c,
+  0x048d,
+  0x048e,
+  0x048f,
+  0x0490,
+  0x0491,
+  0x0492,
+  0x0493,
+  0x0494,
+  0x0495,
+  0x0496,
+  0x0497,
+  0x0498,
+  0x0499,
+  0x049a,
+  0x049b,
+  0x049c,
+  0x049d,
+  0x049e,
+  0x049f,
+  0x04a0,
+  0x04a1,
+  0x04a2,
+  0x04a3,
+  0x04a4,
+  0x04a5,
+  0x04a6,
+  0x04a7,
+  0x04a8,
+  0x04a9,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0xffff,
+  0x04aa,
+  0x04ab,
+  0x04ac,
+  0x04ad,
+  0x015f,
+  0x04ae,
+};
+
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Rectangles are width bytes by lines, consecutive lines are pitch bytes
+// apart. Operations may run asynchronously until wait returns.
+struct blitter {
+  void (*fill)(uint8_t *dst, size_t pitch, size_t width, size_t lines,
+               uint8_t value);
+  // Source and destination overlap only within the same lines
+  void (*copy)(uint8_t *dst, const uint8_t *src, size_t pitch, size_t width,
+               size_t lines);
+  void (*wait)();
+};
+
+extern const struct blitter software_blitter;
@@ -3,13 +3,22 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#define BITMAP_FONT_NO_GLYPH 0xffff
+
+// Glyph indices of one 256 codepoint page, trimmed to [first, last] and
+// stored from offset in page_glyphs
+struct bitmap_font_page {
+  uint16_t offset;
+  uint8_t first;
+  uint8_t last;
+};
+
 struct bitmap_font {
   int height;
   int width;
   const uint8_t *data;
-  size_t codepoints_length;
-  const int *codepoints;
-  const int *codepoints_map;
+  const struct bitmap_font_page *pages;
+  const uint16_t *page_glyphs;
 };
 
 const unsigned char *find_glyph(const struct bitmap_font *font,
@@ -43,6 +43,11 @@ void MX_LTDC_Init(void);
 /* USER CODE BEGIN Prototypes */
 
 struct screen *ltdc_get_screen(struct format format);
+void ltdc_update_scroll_window(struct screen *screen);
+void ltdc_show_cursor(struct screen *screen, size_t row, size_t col);
+void ltdc_hide_cursor();
+void ltdc_set_screen_mode(bool mode);
+void ltdc_set_palette(const rgb_t *palette);
 
 /* USER CODE END Prototypes */
 
@@ -55,6 +55,8 @@ void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
 
+void uart_receive_idle_callback();
+
 /* USER CODE END EFP */
 
 /* Private defines -----------------------------------------------------------*/
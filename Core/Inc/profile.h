@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+
+// Sections are timed inclusively, yield runs inside screen_scroll and
+// screen_clear_rows and both run inside the parser
+enum profile_section {
+  PROFILE_PARSER,
+  PROFILE_RENDER_CHARACTER,
+  PROFILE_SCREEN_SCROLL,
+  PROFILE_SCREEN_CLEAR_ROWS,
+  PROFILE_YIELD,
+  PROFILE_FLOW_CONTROL,
+  PROFILE_SECTIONS_COUNT,
+};
+
+#ifdef PROFILE
+
+void profile_init();
+uint32_t profile_cycles();
+void profile_add(enum profile_section section, uint32_t begin);
+void profile_report();
+
+#define PROFILE_BEGIN(section) uint32_t section##_begin = profile_cycles()
+#define PROFILE_END(section) profile_add(section, section##_begin)
+
+#else
+
+#define PROFILE_BEGIN(section)
+#define PROFILE_END(section)
+
+#endif
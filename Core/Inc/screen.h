@@ -6,6 +6,7 @@
 
 #include "terminal.h"
 #include "font.h"
+#include "blitter.h"
 
 struct screen {
   const struct format format;
@@ -14,6 +15,13 @@ struct screen {
   const struct bitmap_font *normal_bitmap_font;
   const struct bitmap_font *bold_bitmap_font;
   uint8_t* buffer;
+  const struct blitter *blitter;
+  // Buffer is circular and full screen scrolls move top_line
+  bool circular;
+  size_t top_line;
+  // Cursor cell is drawn into alternating buffers shown by an overlay
+  uint8_t *cursor_buffers[2];
+  uint8_t cursor_buffer;
 };
 
 void screen_clear_rows(struct screen *screen, size_t from_row, size_t to_row,
@@ -37,6 +45,10 @@ void screen_draw_codepoint(struct screen *screen, size_t row, size_t col,
                            bool underlined, bool crossedout, color_t active,
                            color_t inactive);
 
+void screen_draw_cursor(struct screen *screen, codepoint_t codepoint,
+                        enum font font, bool italic, bool underlined,
+                        bool crossedout, color_t active, color_t inactive);
+
 void screen_test_fonts(struct screen *screen, enum font font);
 
 #ifdef TERMINAL_8BIT_COLOR
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Part of a circular frame buffer shown through one display layer
+struct scroll_window_layer {
+  bool enabled;
+  uint32_t address;
+  size_t pitch; // bytes from one line to the next
+  size_t y;
+  size_t lines;
+};
+
+size_t scroll_window_line(size_t lines, size_t top_line, size_t line);
+
+void scroll_window_split(uint32_t buffer, size_t line_bytes, size_t lines,
+                         size_t top_line, size_t y,
+                         struct scroll_window_layer *top_layer,
+                         struct scroll_window_layer *wrapped_layer);
@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "rgb.h"
 #include "terminal_config.h"
 
 struct lock_state {
@@ -28,6 +29,8 @@ typedef uint8_t color_t;
 typedef uint8_t character_t;
 typedef uint16_t codepoint_t;
 
+#define REPLACEMENT_CODEPOINT 0xfffd
+
 #define DEFAULT_ACTIVE_COLOR 0xf
 #define DEFAULT_INACTIVE_COLOR 0
 #define CHARACTER_MAX 0xff
@@ -49,6 +52,13 @@ struct terminal_callbacks {
                                 codepoint_t codepoint, enum font font,
                                 bool italic, bool underlined, bool crossedout,
                                 color_t active, color_t inactive);
+  void (*screen_draw_cursor)(struct format format, codepoint_t codepoint,
+                             enum font font, bool italic, bool underlined,
+                             bool crossedout, color_t active, color_t inactive);
+  void (*screen_show_cursor)(struct format format, size_t row, size_t col);
+  void (*screen_hide_cursor)(struct format format);
+  void (*screen_set_mode)(struct format format, bool mode);
+  void (*screen_set_palette)(struct format format, const rgb_t *palette);
   void (*screen_clear_rows)(struct format format, size_t from_row,
                             size_t to_row, color_t inactive);
   void (*screen_clear_cols)(struct format format, size_t row, size_t from_col,
@@ -67,16 +77,12 @@ struct terminal_callbacks {
   void (*write_config)(struct terminal_config *terminal_config_copy);
 };
 
-struct terminal;
-
-typedef void (*receive_t)(struct terminal *, character_t);
-typedef receive_t receive_table_t[CHARACTER_DECODER_TABLE_LENGTH];
-
 typedef codepoint_t
     codepoint_transformation_table_t[CHARACTER_DECODER_TABLE_LENGTH];
 
 #define ESC_MAX_PARAMS_COUNT 16
-#define ESC_MAX_PARAM_LENGTH 16
+// Parameters saturate so they stay positive in the int16_t handlers use
+#define ESC_MAX_PARAM_VALUE INT16_MAX
 
 struct visual_props {
   uint8_t font : 2;
@@ -91,9 +97,28 @@ struct visual_props {
   color_t inactive_color;
 };
 
+// Packed, so a cell takes 5 bytes rather than 6
 struct visual_cell {
   codepoint_t c;
   struct visual_props p;
+} __attribute__((packed));
+
+// Cell drawn into the cursor overlay and where the overlay is shown
+struct cursor_overlay {
+  bool drawn;
+  bool shown;
+  int16_t row;
+  int16_t col;
+  codepoint_t c;
+  struct visual_props p;
+};
+
+#define TERMINAL_MAX_ROWS 32
+
+struct visual_screen {
+  struct visual_cell *cells;
+  struct visual_cell *rows[TERMINAL_MAX_ROWS];
+  uint8_t blink_cells[TERMINAL_MAX_ROWS]; // blinking cells per row
 };
 
 enum gset {
@@ -105,11 +130,47 @@ enum gset {
   GSET_MAX = 4,
 };
 
+enum receive_state {
+  RECEIVE_GROUND,
+  RECEIVE_UTF8,
+  RECEIVE_ESC,
+  RECEIVE_ESC_INTERMEDIATE,
+  RECEIVE_CSI,
+  RECEIVE_CSI_PARAM,
+  RECEIVE_CSI_INTERMEDIATE,
+  RECEIVE_CSI_IGNORE,
+  RECEIVE_OSC,
+  RECEIVE_DCS,
+  RECEIVE_APC,
+  RECEIVE_PM,
+  RECEIVE_VT52_ESC,
+  RECEIVE_VT52_ROW,
+  RECEIVE_VT52_COL,
+  RECEIVE_STATES,
+};
+
 enum xon_off {
   XON,
   XOFF,
 };
 
+// Counted since start up, the UART errors and ring overruns by the
+// platform receiving into the ring, the rest by the terminal
+struct link_statistics {
+  // Times the receive ring was lapped and the unread bytes it overwrote
+  uint32_t ring_overruns;
+  uint32_t ring_lost;
+  uint32_t overrun_errors;
+  uint32_t framing_errors;
+  uint32_t parity_errors;
+  uint32_t noise_errors;
+  uint32_t peak_fill;
+  // Milliseconds spent with XOFF sent
+  uint32_t xoff_time;
+};
+
+struct gset_charset;
+
 struct visual_state {
   int16_t cursor_row;
   int16_t cursor_col;
@@ -118,11 +179,15 @@ struct visual_state {
   struct visual_props p;
 
   enum gset gset_gl;
-  const codepoint_transformation_table_t *gset_table[GSET_MAX];
+  enum gset gset_gr;
+  const struct gset_charset *gset_charset[GSET_MAX];
 };
 
 #define MAX_CONTROL_DATA_LENGTH 64
 
+#define DIRTY_WORD_BITS 32
+#define DIRTY_ROW_WORDS 3
+
 struct control_data {
   character_t data[MAX_CONTROL_DATA_LENGTH];
   size_t length;
@@ -184,24 +249,40 @@ struct terminal {
 
   volatile uint16_t cursor_counter;
   volatile bool cursor_on;
-  bool cursor_drawn;
+  struct cursor_overlay cursor_overlay;
 
   volatile uint16_t blink_counter;
   volatile bool blink_on;
   bool blink_drawn;
 
-  struct visual_cell *cells;
+  bool synchronized_output_mode;
+  volatile uint16_t synchronized_output_counter;
 
-  struct visual_cell *default_cells;
+  rgb_t palette[RGB_TABLE_SIZE];
+  bool palette_dirty;
+
+  struct visual_screen *screen;
+
+  uint32_t dirty_rows;
+  uint32_t dirty_cols[TERMINAL_MAX_ROWS][DIRTY_ROW_WORDS];
+
+  struct visual_screen default_screen;
 #ifdef TERMINAL_ALT_CELLS
-  struct visual_cell *alt_cells;
+  struct visual_screen alt_screen;
 #endif
 
-  const receive_table_t *receive_table;
+  enum receive_state receive_state;
 
-  character_t esc_params[ESC_MAX_PARAMS_COUNT][ESC_MAX_PARAM_LENGTH];
-  size_t esc_params_count;
-  size_t esc_last_param_length;
+  enum gset single_shift;
+  codepoint_t charset_map[CHARACTER_DECODER_TABLE_LENGTH];
+
+  uint16_t esc_params[ESC_MAX_PARAMS_COUNT];
+  // Bit per parameter with digits and per parameter following a colon
+  uint16_t esc_params_given;
+  uint16_t esc_params_sub;
+  uint8_t esc_params_count;
+  character_t esc_private;
+  character_t esc_intermediate;
 
   character_t vt52_move_cursor_row;
 
@@ -211,20 +292,20 @@ struct terminal {
   size_t transmit_buffer_size;
   size_t transmit_buffer_head;
 
-  size_t utf8_codepoint_length;
-  size_t utf8_buffer_length;
-  character_t utf8_buffer[4];
+  uint8_t utf8_state;
+  uint32_t utf8_codepoint;
 
   struct control_data dcs;
   struct control_data osc;
   struct control_data apc;
   struct control_data pm;
 
-  enum gset gset_received;
   enum xon_off xon_off;
 
   bool flow_control;
 
+  struct link_statistics link_statistics;
+
 #ifdef DEBUG
 #define DEBUG_BUFFER_LENGTH 128
   character_t debug_buffer[DEBUG_BUFFER_LENGTH];
@@ -252,6 +333,8 @@ void terminal_uart_receive_character(struct terminal *terminal,
                                      character_t character);
 void terminal_uart_receive_string(struct terminal *terminal,
                                   const char *string);
+void terminal_uart_receive_buffer(struct terminal *terminal,
+                                  const character_t *buffer, size_t size);
 
 void terminal_uart_transmit_character(struct terminal *terminal,
                                       character_t character);
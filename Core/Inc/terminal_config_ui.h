@@ -18,6 +18,7 @@ struct terminal_ui_option {
 struct terminal_ui_menu {
   const char *title;
   const struct terminal_ui_option (*options)[];
+  bool link_statistics;
 };
 
 struct terminal_config_ui {
@@ -12,6 +12,8 @@ void terminal_uart_init(struct terminal *terminal);
 
 void terminal_uart_xon_off(struct terminal *terminal, enum xon_off xon_off);
 
+void terminal_uart_update_xoff_counter(struct terminal *terminal);
+
 void terminal_keyboard_init(struct terminal *terminal,
                             enum keyboard_layout keyboard_layout);
 
@@ -27,6 +29,9 @@ void terminal_screen_update_cursor_counter(struct terminal *terminal);
 
 void terminal_screen_update_blink_counter(struct terminal *terminal);
 
+void terminal_screen_update_synchronized_output_counter(
+    struct terminal *terminal);
+
 void terminal_screen_move_cursor_absolute(struct terminal *terminal,
                                           int16_t row, int16_t col);
 
@@ -57,6 +62,10 @@ void terminal_screen_reverse_index(struct terminal *terminal, int16_t rows);
 void terminal_screen_put_codepoint(struct terminal *terminal,
                                    codepoint_t codepoint);
 
+void terminal_screen_put_codepoints(struct terminal *terminal,
+                                    const codepoint_t *codepoints,
+                                    size_t count);
+
 void terminal_screen_enable_cursor(struct terminal *terminal, bool enable);
 
 void terminal_screen_save_visual_state(struct terminal *terminal);
@@ -71,6 +80,16 @@ void terminal_screen_erase(struct terminal *terminal, size_t cols);
 
 void terminal_screen_set_screen_mode(struct terminal *terminal, bool mode);
 
+void terminal_screen_set_synchronized_output_mode(struct terminal *terminal,
+                                                  bool mode);
+
+void terminal_screen_set_color(struct terminal *terminal, color_t color,
+                               rgb_t rgb);
+
+void terminal_screen_reset_color(struct terminal *terminal, color_t color);
+
+void terminal_screen_reset_palette(struct terminal *terminal);
+
 void terminal_screen_wrap_last_col(struct terminal *terminal);
 
 void terminal_screen_cancel_wrap_last_col(struct terminal *terminal);
@@ -0,0 +1,23 @@
+#include "blitter.h"
+
+#include <string.h>
+
+static void software_fill(uint8_t *dst, size_t pitch, size_t width,
+                          size_t lines, uint8_t value) {
+  for (size_t i = 0; i < lines; ++i, dst += pitch)
+    memset(dst, value, width);
+}
+
+static void software_copy(uint8_t *dst, const uint8_t *src, size_t pitch,
+                          size_t width, size_t lines) {
+  for (size_t i = 0; i < lines; ++i, dst += pitch, src += pitch)
+    memmove(dst, src, width);
+}
+
+static void software_wait() {}
+
+const struct blitter software_blitter = {
+    .fill = software_fill,
+    .copy = software_copy,
+    .wait = software_wait,
+};
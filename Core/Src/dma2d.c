@@ -0,0 +1,190 @@
+/**
+  ******************************************************************************
+  * File Name          : DMA2D.c
+  * Description        : This file provides code for the configuration
+  *                      of the DMA2D instances.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "dma2d.h"
+
+/* USER CODE BEGIN 0 */
+
+#include <stdbool.h>
+
+/* USER CODE END 0 */
+
+DMA2D_HandleTypeDef hdma2d;
+
+/* DMA2D init function */
+void MX_DMA2D_Init(void)
+{
+
+  hdma2d.Instance = DMA2D;
+  hdma2d.Init.Mode = DMA2D_M2M;
+  hdma2d.Init.ColorMode = DMA2D_OUTPUT_ARGB8888;
+  hdma2d.Init.OutputOffset = 0;
+  hdma2d.LayerCfg[1].InputOffset = 0;
+  hdma2d.LayerCfg[1].InputColorMode = DMA2D_INPUT_ARGB8888;
+  hdma2d.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  hdma2d.LayerCfg[1].InputAlpha = 0;
+  if (HAL_DMA2D_Init(&hdma2d) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if (HAL_DMA2D_ConfigLayer(&hdma2d, 1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+}
+
+void HAL_DMA2D_MspInit(DMA2D_HandleTypeDef* dma2dHandle)
+{
+
+  if(dma2dHandle->Instance==DMA2D)
+  {
+  /* USER CODE BEGIN DMA2D_MspInit 0 */
+
+  /* USER CODE END DMA2D_MspInit 0 */
+    /* DMA2D clock enable */
+    __HAL_RCC_DMA2D_CLK_ENABLE();
+  /* USER CODE BEGIN DMA2D_MspInit 1 */
+
+  /* USER CODE END DMA2D_MspInit 1 */
+  }
+}
+
+void HAL_DMA2D_MspDeInit(DMA2D_HandleTypeDef* dma2dHandle)
+{
+
+  if(dma2dHandle->Instance==DMA2D)
+  {
+  /* USER CODE BEGIN DMA2D_MspDeInit 0 */
+
+  /* USER CODE END DMA2D_MspDeInit 0 */
+    /* Peripheral clock disable */
+    __HAL_RCC_DMA2D_CLK_DISABLE();
+  /* USER CODE BEGIN DMA2D_MspDeInit 1 */
+
+  /* USER CODE END DMA2D_MspDeInit 1 */
+  }
+} 
+
+/* USER CODE BEGIN 1 */
+
+#define DMA2D_TIMEOUT 100
+
+// DMA2D moves words, other transfers are left to the CPU
+#define DMA2D_PIXEL_BYTES 4
+
+static bool is_aligned(uint32_t value) {
+  return !(value & (DMA2D_PIXEL_BYTES - 1));
+}
+
+static void dma2d_wait() {
+  if (hdma2d.State == HAL_DMA2D_STATE_BUSY &&
+      HAL_DMA2D_PollForTransfer(&hdma2d, DMA2D_TIMEOUT) != HAL_OK) {
+    Error_Handler();
+  }
+}
+
+static void dma2d_start(uint32_t mode, uint32_t pdata, uint8_t *dst,
+                        size_t pitch, size_t width, size_t lines) {
+  dma2d_wait();
+
+  uint32_t offset = (pitch - width) / DMA2D_PIXEL_BYTES;
+
+  if (hdma2d.Init.Mode != mode || hdma2d.Init.OutputOffset != offset) {
+    hdma2d.Init.Mode = mode;
+    hdma2d.Init.OutputOffset = offset;
+
+    if (HAL_DMA2D_Init(&hdma2d) != HAL_OK) {
+      Error_Handler();
+    }
+  }
+
+  if (mode == DMA2D_M2M && hdma2d.LayerCfg[1].InputOffset != offset) {
+    hdma2d.LayerCfg[1].InputOffset = offset;
+
+    if (HAL_DMA2D_ConfigLayer(&hdma2d, 1) != HAL_OK) {
+      Error_Handler();
+    }
+  }
+
+  if (HAL_DMA2D_Start(&hdma2d, pdata, (uint32_t)dst, width / DMA2D_PIXEL_BYTES,
+                      lines) != HAL_OK) {
+    Error_Handler();
+  }
+}
+
+static void dma2d_fill(uint8_t *dst, size_t pitch, size_t width, size_t lines,
+                       uint8_t value) {
+  if (!width || !lines)
+    return;
+
+  if (!is_aligned((uint32_t)dst | pitch | width)) {
+    dma2d_wait();
+    software_blitter.fill(dst, pitch, width, lines, value);
+    return;
+  }
+
+  dma2d_start(DMA2D_R2M, 0x01010101 * (uint32_t)value, dst, pitch, width,
+              lines);
+}
+
+static void dma2d_copy(uint8_t *dst, const uint8_t *src, size_t pitch,
+                       size_t width, size_t lines) {
+  if (!width || !lines || dst == src)
+    return;
+
+  if (!is_aligned((uint32_t)dst | (uint32_t)src | pitch | width)) {
+    dma2d_wait();
+    software_blitter.copy(dst, src, pitch, width, lines);
+    return;
+  }
+
+  // Overlapping lines are copied in chunks that never overwrite their own
+  // source, starting from the end that is moving away
+  size_t disp = dst > src ? dst - src : src - dst;
+  size_t chunk = disp < width ? disp : width;
+
+  if (dst > src) {
+    for (size_t offset = width; offset;) {
+      size_t size = offset < chunk ? offset : chunk;
+      offset -= size;
+
+      dma2d_start(DMA2D_M2M, (uint32_t)(src + offset), dst + offset, pitch,
+                  size, lines);
+    }
+  } else {
+    for (size_t offset = 0; offset < width; offset += chunk) {
+      size_t size = width - offset < chunk ? width - offset : chunk;
+
+      dma2d_start(DMA2D_M2M, (uint32_t)(src + offset), dst + offset, pitch,
+                  size, lines);
+    }
+  }
+}
+
+const struct blitter dma2d_blitter = {
+    .fill = dma2d_fill,
+    .copy = dma2d_copy,
+    .wait = dma2d_wait,
+};
+
+/* USER CODE END 1 */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -4,22 +4,18 @@
 
 static int32_t find_glyph_index(const struct bitmap_font *font,
                                 unsigned short codepoint) {
-  size_t first = 0;
-  size_t last = font->codepoints_length - 1;
-  size_t middle = (first + last) / 2;
-
-  while (first <= last) {
-    if (font->codepoints[middle] < codepoint)
-      first = middle + 1;
-    else if (font->codepoints[middle] == codepoint)
-      return font->codepoints_map[middle];
-    else
-      last = middle - 1;
-
-    middle = (first + last) / 2;
-  }
-
-  return -1;
+  const struct bitmap_font_page *page = &font->pages[codepoint >> 8];
+  uint8_t low = codepoint & 0xff;
+
+  if (low < page->first || low > page->last)
+    return -1;
+
+  uint16_t index = font->page_glyphs[page->offset + low - page->first];
+
+  if (index == BITMAP_FONT_NO_GLYPH)
+    return -1;
+
+  return index;
 }
 
 const uint8_t *find_glyph(const struct bitmap_font *font,
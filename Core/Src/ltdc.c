@@ -22,10 +22,13 @@
 
 /* USER CODE BEGIN 0 */
 
+#include "dma2d.h"
 #include "rgb.h"
+#include "scroll_window.h"
 
 #include "FontProblems/bold.h"
 #include "FontProblems/normal.h"
+#include "FontProblems/font_index.h"
 
 extern struct terminal_config terminal_config;
 
@@ -36,34 +39,37 @@ static const struct bitmap_font normal_bitmap_font = {
     .height = FONT_HEIGHT,
     .width = FONT_WIDTH,
     .data = normal_font_data,
-    .codepoints_length = sizeof(normal_font_codepoints) / sizeof(int),
-    .codepoints = normal_font_codepoints,
-    .codepoints_map = normal_font_codepoints_map,
+    .pages = normal_font_pages,
+    .page_glyphs = normal_font_page_glyphs,
 };
 
 static const struct bitmap_font bold_bitmap_font = {
     .height = FONT_HEIGHT,
     .width = FONT_WIDTH,
     .data = bold_font_data,
-    .codepoints_length = sizeof(bold_font_codepoints) / sizeof(int),
-    .codepoints = bold_font_codepoints,
-    .codepoints_map = bold_font_codepoints_map,
+    .pages = bold_font_pages,
+    .page_glyphs = bold_font_page_glyphs,
 };
 
 #define CHAR_WIDTH 8
 #define CHAR_HEIGHT 16
 
- __attribute__((section(".dma"))) static uint8_t screen_buffer[CHAR_WIDTH * CHAR_HEIGHT * 80 * 30];
+__attribute__((section(".dma"), aligned(4))) static uint8_t screen_buffer[CHAR_WIDTH * CHAR_HEIGHT * 80 * 30];
 
 #define SCREEN_BUFFER (uint32_t)&screen_buffer
 
+__attribute__((section(".dma"), aligned(4))) static uint8_t cursor_buffers[2][CHAR_WIDTH * CHAR_HEIGHT];
+
 static struct screen screen_24_rows = {
     .format = {.rows = 24, .cols = 80},
     .char_width = CHAR_WIDTH,
     .char_height = CHAR_HEIGHT,
     .buffer = (uint8_t *)SCREEN_BUFFER,
+    .blitter = &dma2d_blitter,
     .normal_bitmap_font = &normal_bitmap_font,
     .bold_bitmap_font = &bold_bitmap_font,
+    .circular = true,
+    .cursor_buffers = {cursor_buffers[0], cursor_buffers[1]},
 };
 
 static struct screen screen_30_rows = {
@@ -71,8 +77,11 @@ static struct screen screen_30_rows = {
     .char_width = CHAR_WIDTH,
     .char_height = CHAR_HEIGHT,
     .buffer = (uint8_t *)SCREEN_BUFFER,
+    .blitter = &dma2d_blitter,
     .normal_bitmap_font = &normal_bitmap_font,
     .bold_bitmap_font = &bold_bitmap_font,
+    .circular = true,
+    .cursor_buffers = {cursor_buffers[0], cursor_buffers[1]},
 };
 
 struct screen *ltdc_get_screen(struct format format) {
@@ -94,6 +103,46 @@ static uint8_t reverse_byte(uint8_t byte) {
   return reversed_byte;
 }
 
+static const rgb_t *clut_palette = rgb_table;
+static bool clut_screen_mode = false;
+
+// Screen mode swaps the default colors, other colors keep their entries. The
+// cursor layer also swaps the inverted default colors the cursor is drawn in,
+// so the cursor stays inverted against the swapped screen
+static color_t clut_color(color_t color, uint32_t layer_idx) {
+  if (clut_screen_mode) {
+    if (color == DEFAULT_ACTIVE_COLOR)
+      return DEFAULT_INACTIVE_COLOR;
+    else if (color == DEFAULT_INACTIVE_COLOR)
+      return DEFAULT_ACTIVE_COLOR;
+    else if (layer_idx == 1 && color == (color_t)~DEFAULT_ACTIVE_COLOR)
+      return ~DEFAULT_INACTIVE_COLOR;
+    else if (layer_idx == 1 && color == (color_t)~DEFAULT_INACTIVE_COLOR)
+      return ~DEFAULT_ACTIVE_COLOR;
+  }
+
+  return color;
+}
+
+static void config_clut() {
+  // Fix CLUT for 3.0 board that has RGB2-7 pins reversed
+  uint32_t rgb_table_fixed[RGB_TABLE_SIZE];
+
+  for (uint32_t layer_idx = 0; layer_idx < MAX_LAYER; ++layer_idx) {
+    for (size_t i = 0; i < RGB_TABLE_SIZE; ++i) {
+      uint32_t entry = clut_palette[clut_color(i, layer_idx)];
+      rgb_table_fixed[i] = reverse_byte((entry & 0xff) >> 2) |
+                           (reverse_byte(((entry >> 8) & 0xff) >> 2) << 8) |
+                           (reverse_byte(((entry >> 16) & 0xff) >> 2) << 16);
+    }
+
+    if (HAL_LTDC_ConfigCLUT(&hltdc, (uint32_t *)rgb_table_fixed,
+                            RGB_TABLE_SIZE, layer_idx) != HAL_OK) {
+      Error_Handler();
+    }
+  }
+}
+
 /* USER CODE END 0 */
 
 LTDC_HandleTypeDef hltdc;
@@ -152,24 +201,28 @@ void MX_LTDC_Init(void)
     Error_Handler();
   }
 
-  // Fix CLUT for 3.0 board that has RGB2-7 pins reversed
-  uint32_t rgb_table_fixed[RGB_TABLE_SIZE];
-
-  for (size_t i = 0; i < RGB_TABLE_SIZE; ++i) {
-    uint32_t entry = rgb_table[i];
-    rgb_table_fixed[i] = reverse_byte((entry & 0xff) >> 2) |
-                         (reverse_byte(((entry >> 8) & 0xff) >> 2) << 8) |
-                         (reverse_byte(((entry >> 16) & 0xff) >> 2) << 16);
+  if (HAL_LTDC_EnableCLUT(&hltdc, 0) != HAL_OK) {
+    Error_Handler();
   }
 
-  if (HAL_LTDC_ConfigCLUT(&hltdc, (uint32_t *)rgb_table_fixed, RGB_TABLE_SIZE, 0) !=
-      HAL_OK) {
+  // Layer 1 shows the cursor cell over the screen
+  pLayerCfg.WindowX1 = pLayerCfg.WindowX0 + CHAR_WIDTH;
+  pLayerCfg.WindowY1 = pLayerCfg.WindowY0 + CHAR_HEIGHT;
+  pLayerCfg.FBStartAdress = (uint32_t)cursor_buffers[0];
+  pLayerCfg.ImageWidth = CHAR_WIDTH;
+  pLayerCfg.ImageHeight = CHAR_HEIGHT;
+  if (HAL_LTDC_ConfigLayer(&hltdc, &pLayerCfg, 1) != HAL_OK) {
     Error_Handler();
   }
 
-  if (HAL_LTDC_EnableCLUT(&hltdc, 0) != HAL_OK) {
+  if (HAL_LTDC_EnableCLUT(&hltdc, 1) != HAL_OK) {
     Error_Handler();
   }
+
+  config_clut();
+
+  __HAL_LTDC_LAYER_DISABLE(&hltdc, 1);
+  __HAL_LTDC_RELOAD_IMMEDIATE_CONFIG(&hltdc);
 }
 
 void HAL_LTDC_MspInit(LTDC_HandleTypeDef* ltdcHandle)
@@ -257,6 +310,9 @@ void HAL_LTDC_MspInit(LTDC_HandleTypeDef* ltdcHandle)
     GPIO_InitStruct.Alternate = GPIO_AF14_LTDC;
     HAL_GPIO_Init(GPIOD, &GPIO_InitStruct);
 
+    /* LTDC interrupt Init */
+    HAL_NVIC_SetPriority(LTDC_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(LTDC_IRQn);
   /* USER CODE BEGIN LTDC_MspInit 1 */
 
   /* USER CODE END LTDC_MspInit 1 */
@@ -311,6 +367,8 @@ void HAL_LTDC_MspDeInit(LTDC_HandleTypeDef* ltdcHandle)
 
     HAL_GPIO_DeInit(GPIOD, GPIO_PIN_10|GPIO_PIN_3|GPIO_PIN_6);
 
+    /* LTDC interrupt Deinit */
+    HAL_NVIC_DisableIRQ(LTDC_IRQn);
   /* USER CODE BEGIN LTDC_MspDeInit 1 */
 
   /* USER CODE END LTDC_MspDeInit 1 */
@@ -319,6 +377,144 @@ void HAL_LTDC_MspDeInit(LTDC_HandleTypeDef* ltdcHandle)
 
 /* USER CODE BEGIN 1 */
 
+#define LTDC_ACTIVE_HEIGHT 480
+
+// Line interrupt comes this many lines before the wrapped part so other
+// interrupts delaying it still leave time to move the layer
+#define LTDC_WRAP_EVENT_LINES 2
+
+static size_t window_top_line;
+
+// Parts of the circular buffer shown in this frame, and the ones taken over
+// at its end
+static struct scroll_window_layer window_top, window_wrapped;
+static struct scroll_window_layer next_window_top, next_window_wrapped;
+static bool window_wrap_event;
+
+static uint32_t active_line(size_t y) {
+  return (hltdc.Instance->BPCR & LTDC_BPCR_AVBP) + 1 + y;
+}
+
+static uint32_t frame_end_line() {
+  return (hltdc.Instance->AWCR & LTDC_AWCR_AAH) + 1;
+}
+
+static void program_line_event(uint32_t line) {
+  hltdc.Instance->LIPCR = line;
+  __HAL_LTDC_ENABLE_IT(&hltdc, LTDC_IT_LI);
+}
+
+// Layer 0 registers are written the way HAL_LTDC_ConfigLayer lays them out,
+// without its lock, since this runs from the line interrupt
+static void show_window_part(const struct scroll_window_layer *part) {
+  LTDC_Layer_TypeDef *layer = LTDC_LAYER(&hltdc, 0);
+
+  layer->WVPCR = active_line(part->y) |
+                 ((active_line(part->y + part->lines) - 1) << 16);
+  layer->CFBAR = part->address;
+  layer->CFBLR = (part->pitch << 16) | (layer->CFBLR & LTDC_LxCFBLR_CFBLL);
+  layer->CFBLNR = part->lines;
+  hltdc.Instance->SRCR = LTDC_SRCR_IMR;
+}
+
+// Layer 0 shows the top part of the circular buffer from the start of each
+// frame. While the window wraps, it is moved onto the wrapped part once the
+// scan leaves the top part and moved back at the end of the frame, so layer
+// 1 is left to the cursor
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *ltdc) {
+  if (window_wrap_event) {
+    uint32_t line = active_line(window_wrapped.y);
+
+    while ((ltdc->Instance->CPSR & LTDC_CPSR_CYPOS) < line)
+      ;
+
+    show_window_part(&window_wrapped);
+    window_wrap_event = false;
+    program_line_event(frame_end_line());
+    return;
+  }
+
+  window_top = next_window_top;
+  window_wrapped = next_window_wrapped;
+  show_window_part(&window_top);
+
+  if (window_wrapped.enabled) {
+    window_wrap_event = true;
+    program_line_event(active_line(window_wrapped.y) - LTDC_WRAP_EVENT_LINES);
+  }
+}
+
+// New window is taken over at the end of the frame being shown
+void ltdc_update_scroll_window(struct screen *screen) {
+  if (screen->top_line == window_top_line)
+    return;
+
+  size_t lines = screen->format.rows * screen->char_height;
+  struct scroll_window_layer top_layer, wrapped_layer;
+
+  scroll_window_split(SCREEN_BUFFER, screen->format.cols * screen->char_width,
+                      lines, screen->top_line,
+                      (LTDC_ACTIVE_HEIGHT - lines) / 2, &top_layer,
+                      &wrapped_layer);
+
+  __disable_irq();
+
+  next_window_top = top_layer;
+  next_window_wrapped = wrapped_layer;
+
+  if (!(hltdc.Instance->IER & LTDC_IER_LIE))
+    program_line_event(frame_end_line());
+
+  __enable_irq();
+
+  window_top_line = screen->top_line;
+}
+
+void ltdc_show_cursor(struct screen *screen, size_t row, size_t col) {
+  LTDC_LayerCfgTypeDef layer_cfg = hltdc.LayerCfg[1];
+
+  layer_cfg.WindowX0 = hltdc.LayerCfg[0].WindowX0 + col * screen->char_width;
+  layer_cfg.WindowX1 = layer_cfg.WindowX0 + screen->char_width;
+  layer_cfg.WindowY0 = hltdc.LayerCfg[0].WindowY0 + row * screen->char_height;
+  layer_cfg.WindowY1 = layer_cfg.WindowY0 + screen->char_height;
+  layer_cfg.FBStartAdress =
+      (uint32_t)screen->cursor_buffers[screen->cursor_buffer];
+
+  if (HAL_LTDC_ConfigLayer_NoReload(&hltdc, &layer_cfg, 1) != HAL_OK) {
+    Error_Handler();
+  }
+
+  if (HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING) != HAL_OK) {
+    Error_Handler();
+  }
+}
+
+// CLUT is rewritten during vertical blanking to avoid tearing
+static void reload_clut() {
+  while (hltdc.Instance->CDSR & LTDC_CDSR_VDES)
+    ;
+
+  config_clut();
+}
+
+void ltdc_set_screen_mode(bool mode) {
+  clut_screen_mode = mode;
+  reload_clut();
+}
+
+void ltdc_set_palette(const rgb_t *palette) {
+  clut_palette = palette;
+  reload_clut();
+}
+
+void ltdc_hide_cursor() {
+  __HAL_LTDC_LAYER_DISABLE(&hltdc, 1);
+
+  if (HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING) != HAL_OK) {
+    Error_Handler();
+  }
+}
+
 /* USER CODE END 1 */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
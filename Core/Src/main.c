@@ -21,6 +21,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "dma.h"
+#include "dma2d.h"
 #include "ltdc.h"
 #include "tim.h"
 #include "usart.h"
@@ -38,6 +39,7 @@
 #include "usbd_cdc_if.h"
 
 #include "keys.h"
+#include "profile.h"
 #include "terminal.h"
 #include "terminal_config_ui.h"
 
@@ -87,6 +89,7 @@ struct terminal_config_ui *global_terminal_config_ui = NULL;
 
 #define UART_TRANSMIT_BUFFER_SIZE 256
 #define UART_RECEIVE_BUFFER_SIZE (1024 * 16)
+#define UART_RECEIVE_CHUNK_SIZE 64
 #define LOCAL_BUFFER_SIZE 256
 
 __attribute__((section(".dma"))) static character_t
@@ -99,6 +102,120 @@ static character_t local_buffer[LOCAL_BUFFER_SIZE];
 static size_t local_head = 0;
 static size_t local_tail = 0;
 
+// Positions count bytes since start up, the ring size is a power of two so
+// they wrap into it with a mask
+#define UART_RECEIVE_INDEX(position)                                           \
+  ((position) & (UART_RECEIVE_BUFFER_SIZE - 1))
+
+// Producer position is published only by the receive interrupts, the main
+// loop only advances the consumer position
+static volatile uint32_t uart_receive_head = 0;
+static volatile bool uart_receive_aborted = false;
+
+static uint32_t uart_receive_tail = 0;
+
+// Position the DMA has written up to, advanced from a published position.
+// It is exact while the DMA moves less than the ring between publishes, which
+// the half and full transfer interrupts make sure of
+static uint32_t get_uart_receive_position(uint32_t head) {
+  uint32_t index = UART_RECEIVE_BUFFER_SIZE - huart7.hdmarx->Instance->NDTR;
+
+  return head + UART_RECEIVE_INDEX(index - head);
+}
+
+static void publish_uart_receive_head() {
+  uart_receive_head = get_uart_receive_position(uart_receive_head);
+}
+
+void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart) {
+  if (huart == &huart7)
+    publish_uart_receive_head();
+}
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
+  if (huart == &huart7)
+    publish_uart_receive_head();
+}
+
+// Line went idle after a burst shorter than half the ring
+void uart_receive_idle_callback() { publish_uart_receive_head(); }
+
+// HAL aborts DMA reception on any receive error, reception is started again
+// once the ring is drained
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
+  if (huart != &huart7 || !global_terminal)
+    return;
+
+  struct link_statistics *link_statistics = &global_terminal->link_statistics;
+
+  if (huart->ErrorCode & HAL_UART_ERROR_ORE)
+    link_statistics->overrun_errors++;
+  if (huart->ErrorCode & HAL_UART_ERROR_FE)
+    link_statistics->framing_errors++;
+  if (huart->ErrorCode & HAL_UART_ERROR_PE)
+    link_statistics->parity_errors++;
+  if (huart->ErrorCode & HAL_UART_ERROR_NE)
+    link_statistics->noise_errors++;
+
+  if (huart->RxState == HAL_UART_STATE_READY)
+    uart_receive_aborted = true;
+}
+
+// DMA writes from the start of the ring again, both positions are moved up
+// to it with interrupts masked since the stopped DMA cannot be read from
+static void start_uart_receive() {
+  __disable_irq();
+
+  uart_receive_tail = (uart_receive_tail + UART_RECEIVE_BUFFER_SIZE - 1) &
+                      ~(uint32_t)(UART_RECEIVE_BUFFER_SIZE - 1);
+  uart_receive_head = uart_receive_tail;
+  uart_receive_aborted = false;
+
+  while (HAL_UART_Receive_DMA(&huart7, uart_receive_buffer,
+                              UART_RECEIVE_BUFFER_SIZE) != HAL_OK)
+    ;
+
+  __HAL_UART_ENABLE_IT(&huart7, UART_IT_IDLE);
+  __enable_irq();
+}
+
+// Bytes received past uart_receive_tail, more than the ring holds when the
+// DMA has lapped the tail
+static uint32_t get_uart_receive_pending() {
+  return get_uart_receive_position(uart_receive_head) - uart_receive_tail;
+}
+
+// Bytes to read from the ring. When the DMA has lapped the tail the bytes it
+// wrote over are counted as lost and reading goes on from the oldest byte
+// left in the ring
+static uint32_t get_uart_receive_size() {
+  uint32_t size = get_uart_receive_pending();
+
+  if (size > UART_RECEIVE_BUFFER_SIZE) {
+    struct link_statistics *link_statistics =
+        &global_terminal->link_statistics;
+
+    link_statistics->ring_overruns++;
+    link_statistics->ring_lost += size - UART_RECEIVE_BUFFER_SIZE;
+
+    uart_receive_tail += size - UART_RECEIVE_BUFFER_SIZE;
+    size = UART_RECEIVE_BUFFER_SIZE;
+  }
+
+  return size;
+}
+
+// Interrupts are masked around the check so one arriving after it still
+// ends the sleep
+static void sleep_until_received() {
+  __disable_irq();
+
+  if (local_tail == local_head && !get_uart_receive_pending())
+    __WFI();
+
+  __enable_irq();
+}
+
 #define MAX_COLS 80
 #define MAX_ROWS 30
 #define TAB_STOPS_SIZE (MAX_COLS / 8)
@@ -144,6 +261,8 @@ static void reset() {
 }
 
 static void yield() {
+  PROFILE_BEGIN(PROFILE_YIELD);
+
   MX_USB_HOST_Process();
 
   if (Appli_state == APPLICATION_READY) {
@@ -168,6 +287,8 @@ static void yield() {
           info->lgui || info->rgui, menu, key);
     }
   }
+
+  PROFILE_END(PROFILE_YIELD);
 }
 
 static void uart_transmit(character_t *characters, size_t size, size_t head) {
@@ -198,9 +319,38 @@ static void screen_draw_codepoint_callback(struct format format, size_t row,
                         italic, underlined, crossedout, active, inactive);
 }
 
+static void screen_draw_cursor_callback(struct format format,
+                                        codepoint_t codepoint, enum font font,
+                                        bool italic, bool underlined,
+                                        bool crossedout, color_t active,
+                                        color_t inactive) {
+  screen_draw_cursor(ltdc_get_screen(format), codepoint, font, italic,
+                     underlined, crossedout, active, inactive);
+}
+
+static void screen_show_cursor_callback(struct format format, size_t row,
+                                        size_t col) {
+  ltdc_show_cursor(ltdc_get_screen(format), row, col);
+}
+
+static void screen_hide_cursor_callback(struct format format) {
+  ltdc_hide_cursor();
+}
+
+static void screen_set_mode_callback(struct format format, bool mode) {
+  ltdc_set_screen_mode(mode);
+}
+
+static void screen_set_palette_callback(struct format format,
+                                        const rgb_t *palette) {
+  ltdc_set_palette(palette);
+}
+
 static void screen_clear_rows_callback(struct format format, size_t from_row,
                                        size_t to_row, color_t inactive) {
+  PROFILE_BEGIN(PROFILE_SCREEN_CLEAR_ROWS);
   screen_clear_rows(ltdc_get_screen(format), from_row, to_row, inactive, yield);
+  PROFILE_END(PROFILE_SCREEN_CLEAR_ROWS);
 }
 
 static void screen_clear_cols_callback(struct format format, size_t row,
@@ -213,8 +363,12 @@ static void screen_clear_cols_callback(struct format format, size_t row,
 static void screen_scroll_callback(struct format format, enum scroll scroll,
                                    size_t from_row, size_t to_row, size_t rows,
                                    color_t inactive) {
-  screen_scroll(ltdc_get_screen(format), scroll, from_row, to_row, rows,
-                inactive, yield);
+  struct screen *screen = ltdc_get_screen(format);
+
+  PROFILE_BEGIN(PROFILE_SCREEN_SCROLL);
+  screen_scroll(screen, scroll, from_row, to_row, rows, inactive, yield);
+  ltdc_update_scroll_window(screen);
+  PROFILE_END(PROFILE_SCREEN_SCROLL);
 }
 
 static void screen_shift_right_callback(struct format format, size_t row,
@@ -314,13 +468,19 @@ int main(void)
   MX_USB_HOST_Init();
   MX_USB_DEVICE_Init();
   MX_TIM1_Init();
+  MX_DMA2D_Init();
   /* USER CODE BEGIN 2 */
 
-  struct terminal terminal;
+  static struct terminal terminal;
   struct terminal_callbacks callbacks = {
       .keyboard_set_leds = keyboard_set_leds,
       .uart_transmit = uart_transmit,
       .screen_draw_codepoint = screen_draw_codepoint_callback,
+      .screen_draw_cursor = screen_draw_cursor_callback,
+      .screen_show_cursor = screen_show_cursor_callback,
+      .screen_hide_cursor = screen_hide_cursor_callback,
+      .screen_set_mode = screen_set_mode_callback,
+      .screen_set_palette = screen_set_palette_callback,
       .screen_clear_rows = screen_clear_rows_callback,
       .screen_clear_cols = screen_clear_cols_callback,
       .screen_scroll = screen_scroll_callback,
@@ -342,12 +502,12 @@ int main(void)
 
   terminal_keyboard_update_leds(&terminal);
 
-  HAL_TIM_Base_Start_IT(&htim1);
-  while (HAL_UART_Receive_DMA(&huart7, uart_receive_buffer,
-                              UART_RECEIVE_BUFFER_SIZE) != HAL_OK)
-    ;
+#ifdef PROFILE
+  profile_init();
+#endif
 
-  uint16_t uart_receive_tail = 0;
+  HAL_TIM_Base_Start_IT(&htim1);
+  start_uart_receive();
 
   HAL_GPIO_WritePin(READY_LED_GPIO_Port, READY_LED_Pin, GPIO_PIN_SET);
 
@@ -366,6 +526,10 @@ int main(void)
 
     yield();
 
+#ifdef PROFILE
+    profile_report();
+#endif
+
     if (terminal_config_ui.activated)
       continue;
 
@@ -376,50 +540,59 @@ int main(void)
       else
         size = local_head + (LOCAL_BUFFER_SIZE - local_tail);
 
-      while (size--) {
-        character_t character = local_buffer[local_tail];
-        terminal_uart_receive_character(&terminal, character);
-        local_tail++;
+      while (size) {
+        size_t chunk = LOCAL_BUFFER_SIZE - local_tail;
+        if (chunk > size)
+          chunk = size;
+
+        terminal_uart_receive_buffer(&terminal, local_buffer + local_tail,
+                                     chunk);
+        local_tail += chunk;
+        size -= chunk;
 
         if (local_tail == LOCAL_BUFFER_SIZE)
           local_tail = 0;
       }
     }
 
-    uint16_t uart_receive_head =
-        UART_RECEIVE_BUFFER_SIZE - huart7.hdmarx->Instance->NDTR;
-
-    if (uart_receive_tail != uart_receive_head) {
-      uint16_t size = 0;
-      if (uart_receive_tail < uart_receive_head)
-        size = uart_receive_head - uart_receive_tail;
-      else
-        size =
-            uart_receive_head + (UART_RECEIVE_BUFFER_SIZE - uart_receive_tail);
+    uint32_t size = get_uart_receive_size();
 
+    if (size) {
 #ifdef DEBUG_LOG_RX
-      printf("RX: %d\r\n", size);
+      printf("RX: %lu\r\n", size);
 #endif
 
       terminal_uart_flow_control(&terminal, size);
 
-      while (size--) {
+      while (size) {
         yield();
 
         if (terminal_config_ui.activated)
           break;
 
-        terminal_uart_flow_control(&terminal, size);
+        uint16_t index = UART_RECEIVE_INDEX(uart_receive_tail);
+        uint16_t chunk = UART_RECEIVE_BUFFER_SIZE - index;
+        if (chunk > size)
+          chunk = size;
+
+        if (chunk > UART_RECEIVE_CHUNK_SIZE)
+          chunk = UART_RECEIVE_CHUNK_SIZE;
 
-        character_t character = uart_receive_buffer[uart_receive_tail];
-        terminal_uart_receive_character(&terminal, character);
-        uart_receive_tail++;
+        size -= chunk;
+        terminal_uart_flow_control(&terminal,
+                                   get_uart_receive_pending() - chunk);
 
-        if (uart_receive_tail == UART_RECEIVE_BUFFER_SIZE)
-          uart_receive_tail = 0;
+        terminal_uart_receive_buffer(&terminal, uart_receive_buffer + index,
+                                     chunk);
+        uart_receive_tail += chunk;
       }
     } else {
       terminal_uart_flow_control(&terminal, 0);
+
+      if (uart_receive_aborted)
+        start_uart_receive();
+      else
+        sleep_until_received();
     }
   }
   /* USER CODE END 3 */
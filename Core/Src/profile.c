@@ -0,0 +1,73 @@
+#include "profile.h"
+
+#include "main.h"
+
+#include <stdio.h>
+
+// Counters are printed and cleared every period over the USB CDC _write path
+#define PROFILE_REPORT_PERIOD 5000
+
+struct profile_counter {
+  uint64_t cycles;
+  uint32_t calls;
+};
+
+static const char *const profile_section_names[PROFILE_SECTIONS_COUNT] = {
+    [PROFILE_PARSER] = "parser",
+    [PROFILE_RENDER_CHARACTER] = "render_character",
+    [PROFILE_SCREEN_SCROLL] = "screen_scroll",
+    [PROFILE_SCREEN_CLEAR_ROWS] = "screen_clear_rows",
+    [PROFILE_YIELD] = "yield",
+    [PROFILE_FLOW_CONTROL] = "flow_control",
+};
+
+static struct profile_counter profile_counters[PROFILE_SECTIONS_COUNT];
+static uint32_t profile_report_tick;
+
+void profile_init() {
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  profile_report_tick = HAL_GetTick();
+}
+
+uint32_t profile_cycles() { return DWT->CYCCNT; }
+
+// Cycle counter wraps in about 24 seconds at 180 MHz, a single section is
+// always shorter so the unsigned difference is exact
+void profile_add(enum profile_section section, uint32_t begin) {
+  struct profile_counter *counter = &profile_counters[section];
+
+  counter->cycles += DWT->CYCCNT - begin;
+  counter->calls++;
+}
+
+// Totals are printed in thousands of cycles since nano printf has no 64 bit
+// conversions
+void profile_report() {
+  uint32_t tick = HAL_GetTick();
+  uint32_t period = tick - profile_report_tick;
+
+  if (period < PROFILE_REPORT_PERIOD)
+    return;
+
+  uint64_t period_cycles = (uint64_t)period * (SystemCoreClock / 1000);
+
+  printf("PROFILE: %lu ms\r\n", period);
+
+  for (size_t i = 0; i < PROFILE_SECTIONS_COUNT; ++i) {
+    struct profile_counter *counter = &profile_counters[i];
+
+    printf("  %-18s %8lu calls %10lu kcycles %6lu cycles/call %3lu%%\r\n",
+           profile_section_names[i], counter->calls,
+           (uint32_t)(counter->cycles / 1000),
+           counter->calls ? (uint32_t)(counter->cycles / counter->calls) : 0,
+           (uint32_t)(counter->cycles * 100 / period_cycles));
+
+    counter->cycles = 0;
+    counter->calls = 0;
+  }
+
+  profile_report_tick = tick;
+}
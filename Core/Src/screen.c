@@ -1,11 +1,9 @@
 #include "screen.h"
+#include "scroll_window.h"
 
 #ifdef TERMINAL_8BIT_COLOR
 #include <complex.h>
 #endif
-#include <string.h>
-
-#define REPLACEMENT_CODEPOINT 0xfffd
 
 #define ROWS screen->format.rows
 #define COLS screen->format.cols
@@ -24,17 +22,44 @@
 #define SCREEN_WIDTH_BYTES (COLS * CHAR_WIDTH_BYTES)
 #define SCREEN_HEIGHT_LINES (ROWS * CHAR_HEIGHT_LINES)
 
-static inline void clear_line(color_t inactive, uint8_t *buffer, size_t size) {
+static inline uint8_t *line_buffer(struct screen *screen, size_t line) {
+  return screen->buffer +
+         SCREEN_WIDTH_BYTES *
+             scroll_window_line(SCREEN_HEIGHT_LINES, screen->top_line, line);
+}
+
+// Top line moves by whole rows so a row never wraps around the buffer
+static inline uint8_t *row_buffer(struct screen *screen, size_t row) {
+  return line_buffer(screen, CHAR_HEIGHT_LINES * row);
+}
+
+static inline uint8_t *cell_buffer(struct screen *screen, size_t row,
+                                   size_t col) {
+  return row_buffer(screen, row) + CHAR_WIDTH_BYTES * col;
+}
+
+static inline uint8_t inactive_byte(color_t inactive) {
 #ifdef TERMINAL_8BIT_COLOR
-  memset(buffer, inactive, size);
+  return inactive;
 #else
-  if (inactive == DEFAULT_ACTIVE_COLOR)
-    memset(buffer, 0xff, size);
-  else
-    memset(buffer, 0, size);
+  return inactive == DEFAULT_ACTIVE_COLOR ? 0xff : 0;
 #endif
 }
 
+static inline void fill_row(struct screen *screen, size_t row, size_t offset,
+                            size_t size, color_t inactive) {
+  screen->blitter->fill(row_buffer(screen, row) + offset, SCREEN_WIDTH_BYTES,
+                        size, CHAR_HEIGHT_LINES, inactive_byte(inactive));
+}
+
+static inline void copy_row(struct screen *screen, size_t to_row,
+                            size_t to_offset, size_t from_row,
+                            size_t from_offset, size_t size) {
+  screen->blitter->copy(row_buffer(screen, to_row) + to_offset,
+                        row_buffer(screen, from_row) + from_offset,
+                        SCREEN_WIDTH_BYTES, size, CHAR_HEIGHT_LINES);
+}
+
 void screen_clear_rows(struct screen *screen, size_t from_row, size_t to_row,
                        color_t inactive, void (*yield)()) {
   if (to_row <= from_row)
@@ -43,12 +68,8 @@ void screen_clear_rows(struct screen *screen, size_t from_row, size_t to_row,
   if (to_row > ROWS)
     return;
 
-  size_t lines = CHAR_HEIGHT_LINES * (to_row - from_row);
-  size_t offset = SCREEN_WIDTH_BYTES * CHAR_HEIGHT_LINES * from_row;
-  uint8_t *buffer = screen->buffer + offset;
-
-  for (size_t i = 0; i < lines; ++i, buffer += SCREEN_WIDTH_BYTES) {
-    clear_line(inactive, buffer, SCREEN_WIDTH_BYTES);
+  for (size_t row = from_row; row < to_row; ++row) {
+    fill_row(screen, row, 0, SCREEN_WIDTH_BYTES, inactive);
 
     yield();
   }
@@ -65,16 +86,10 @@ void screen_clear_cols(struct screen *screen, size_t row, size_t from_col,
   if (to_col > COLS)
     return;
 
-  size_t size = CHAR_WIDTH_BYTES * (to_col - from_col);
-  size_t offset = SCREEN_WIDTH_BYTES * CHAR_HEIGHT_LINES * row +
-                  CHAR_WIDTH_BYTES * from_col;
-  uint8_t *buffer = screen->buffer + offset;
+  fill_row(screen, row, CHAR_WIDTH_BYTES * from_col,
+           CHAR_WIDTH_BYTES * (to_col - from_col), inactive);
 
-  for (size_t i = 0; i < CHAR_HEIGHT_LINES; ++i, buffer += SCREEN_WIDTH_BYTES) {
-    clear_line(inactive, buffer, size);
-
-    yield();
-  }
+  yield();
 }
 
 void screen_shift_right(struct screen *screen, size_t row, size_t col,
@@ -89,19 +104,12 @@ void screen_shift_right(struct screen *screen, size_t row, size_t col,
     return;
 
   size_t size = CHAR_WIDTH_BYTES * (COLS - col - cols);
-  size_t offset =
-      SCREEN_WIDTH_BYTES * CHAR_HEIGHT_LINES * row + CHAR_WIDTH_BYTES * col;
+  size_t offset = CHAR_WIDTH_BYTES * col;
   size_t disp = CHAR_WIDTH_BYTES * cols;
-  uint8_t *buffer = screen->buffer + offset;
-
-  uint8_t tmp[SCREEN_WIDTH_BYTES];
 
-  for (size_t i = 0; i < CHAR_HEIGHT_LINES; ++i, buffer += SCREEN_WIDTH_BYTES) {
-    memcpy(tmp, buffer, size);
-    memcpy(buffer + disp, tmp, size);
+  copy_row(screen, row, offset + disp, row, offset, size);
 
-    yield();
-  }
+  yield();
 
   screen_clear_cols(screen, row, col, col + cols, inactive, yield);
 }
@@ -118,16 +126,12 @@ void screen_shift_left(struct screen *screen, size_t row, size_t col,
     return;
 
   size_t size = CHAR_WIDTH_BYTES * (COLS - col - cols);
-  size_t offset =
-      SCREEN_WIDTH_BYTES * CHAR_HEIGHT_LINES * row + CHAR_WIDTH_BYTES * col;
+  size_t offset = CHAR_WIDTH_BYTES * col;
   size_t disp = CHAR_WIDTH_BYTES * cols;
-  uint8_t *buffer = screen->buffer + offset;
 
-  for (size_t i = 0; i < CHAR_HEIGHT_LINES; ++i, buffer += SCREEN_WIDTH_BYTES) {
-    memcpy(buffer, buffer + disp, size);
+  copy_row(screen, row, offset, row, offset + disp, size);
 
-    yield();
-  }
+  yield();
 
   screen_clear_cols(screen, row, COLS - cols, COLS, inactive, yield);
 }
@@ -146,26 +150,34 @@ void screen_scroll(struct screen *screen, enum scroll scroll, size_t from_row,
     return;
   }
 
-  size_t disp = SCREEN_WIDTH_BYTES * CHAR_HEIGHT_LINES * rows;
-  size_t lines = CHAR_HEIGHT_LINES * (to_row - from_row - rows);
-  if (scroll == SCROLL_DOWN) {
-    size_t offset =
-        SCREEN_WIDTH_BYTES * CHAR_HEIGHT_LINES * to_row - SCREEN_WIDTH_BYTES;
-    uint8_t *buffer = screen->buffer + offset;
+  // Scrolling the whole circular buffer only moves its top line
+  if (screen->circular && from_row == 0 && to_row == ROWS) {
+    size_t disp = CHAR_HEIGHT_LINES * rows;
+
+    if (scroll == SCROLL_DOWN) {
+      screen->top_line = scroll_window_line(
+          SCREEN_HEIGHT_LINES, screen->top_line, SCREEN_HEIGHT_LINES - disp);
+      screen_clear_rows(screen, from_row, from_row + rows, inactive, yield);
+    } else if (scroll == SCROLL_UP) {
+      screen->top_line =
+          scroll_window_line(SCREEN_HEIGHT_LINES, screen->top_line, disp);
+      screen_clear_rows(screen, to_row - rows, to_row, inactive, yield);
+    }
 
-    for (size_t i = 0; i < lines; ++i, buffer -= SCREEN_WIDTH_BYTES) {
-      memcpy(buffer, buffer - disp, SCREEN_WIDTH_BYTES);
+    return;
+  }
+
+  if (scroll == SCROLL_DOWN) {
+    for (size_t row = to_row; row > from_row + rows; --row) {
+      copy_row(screen, row - 1, 0, row - 1 - rows, 0, SCREEN_WIDTH_BYTES);
 
       yield();
     }
 
     screen_clear_rows(screen, from_row, from_row + rows, inactive, yield);
   } else if (scroll == SCROLL_UP) {
-    size_t offset = SCREEN_WIDTH_BYTES * CHAR_HEIGHT_LINES * from_row;
-    uint8_t *buffer = screen->buffer + offset;
-
-    for (size_t i = 0; i < lines; ++i, buffer += SCREEN_WIDTH_BYTES) {
-      memcpy(buffer, buffer + disp, SCREEN_WIDTH_BYTES);
+    for (size_t row = from_row; row < to_row - rows; ++row) {
+      copy_row(screen, row, 0, row + rows, 0, SCREEN_WIDTH_BYTES);
 
       yield();
     }
@@ -176,23 +188,28 @@ void screen_scroll(struct screen *screen, enum scroll scroll, size_t from_row,
 
 static inline size_t pixel_offset(struct screen *screen, size_t line,
                                   size_t pixel) {
-  return (SCREEN_WIDTH_BYTES * line) + (pixel >> PIXELS_SHIFT);
+  return (SCREEN_WIDTH_BYTES *
+          scroll_window_line(SCREEN_HEIGHT_LINES, screen->top_line, line)) +
+         (pixel >> PIXELS_SHIFT);
 }
 
-void screen_draw_codepoint(struct screen *screen, size_t row, size_t col,
-                           codepoint_t codepoint, enum font font, bool italic,
-                           bool underlined, bool crossedout, color_t active,
-                           color_t inactive) {
-  if (row >= ROWS)
-    return;
-
-  if (col >= COLS)
-    return;
-
-  size_t base_line = row * CHAR_HEIGHT_LINES;
-  size_t base_pixel = col * CHAR_WIDTH_PIXELS;
-  size_t base_offset = pixel_offset(screen, base_line, base_pixel);
+#ifdef TERMINAL_8BIT_COLOR
+// Expands four glyph bits into four L8 pixel masks, least significant bit
+// being the leftmost pixel
+static const uint32_t nibble_masks[16] = {
+    0x00000000, 0x000000ff, 0x0000ff00, 0x0000ffff, 0x00ff0000, 0x00ff00ff,
+    0x00ffff00, 0x00ffffff, 0xff000000, 0xff0000ff, 0xff00ff00, 0xff00ffff,
+    0xffff0000, 0xffff00ff, 0xffffff00, 0xffffffff,
+};
+
+static inline uint32_t splat_color(color_t color) {
+  return 0x01010101 * (uint32_t)color;
+}
+#endif
 
+static void draw_glyph(struct screen *screen, uint8_t *buffer, size_t pitch,
+                       codepoint_t codepoint, enum font font, bool underlined,
+                       bool crossedout, color_t active, color_t inactive) {
   const struct bitmap_font *bitmap_font;
   if (font == FONT_BOLD) {
     bitmap_font = screen->bold_bitmap_font;
@@ -212,32 +229,30 @@ void screen_draw_codepoint(struct screen *screen, size_t row, size_t col,
   size_t underlined_line = CHAR_HEIGHT_LINES - 2;
   size_t crossedout_line = CHAR_HEIGHT_LINES >> 1;
 
-  for (size_t char_line = 0; char_line < CHAR_HEIGHT_LINES;
-       char_line++, base_offset += SCREEN_WIDTH_BYTES) {
 #ifdef TERMINAL_8BIT_COLOR
-    size_t pixel = base_pixel;
-    size_t pixel_offset = base_offset;
-
-    for (size_t char_pixel = 0; char_pixel < CHAR_WIDTH_PIXELS;
-         char_pixel++, pixel++) {
-
-      color_t color = inactive;
-      uint8_t glyph_mask = 1 << char_pixel;
-
-      if (glyph && ((underlined && char_line == underlined_line) ||
-                    (crossedout && char_line == crossedout_line) ||
-
-                    (char_pixel < bitmap_font->width &&
-                     char_line < bitmap_font->height &&
+  uint32_t inactive_pixels = splat_color(inactive);
+  uint32_t active_pixels = splat_color(active) ^ inactive_pixels;
+  uint8_t width_mask = (1 << bitmap_font->width) - 1;
+#endif
 
-                     glyph[char_line] & glyph_mask))) {
+  for (size_t char_line = 0; char_line < CHAR_HEIGHT_LINES;
+       char_line++, buffer += pitch) {
+#ifdef TERMINAL_8BIT_COLOR
+    uint8_t bits = 0;
 
-        color = active;
-      }
+    if (glyph) {
+      if (char_line < bitmap_font->height)
+        bits = glyph[char_line] & width_mask;
 
-      screen->buffer[pixel_offset] = color;
-      pixel_offset++;
+      if ((underlined && char_line == underlined_line) ||
+          (crossedout && char_line == crossedout_line))
+        bits = 0xff;
     }
+
+    // Eight pixels wide cell is written as two words
+    uint32_t *pixels = (uint32_t *)buffer;
+    pixels[0] = inactive_pixels ^ (nibble_masks[bits & 0xf] & active_pixels);
+    pixels[1] = inactive_pixels ^ (nibble_masks[bits >> 4] & active_pixels);
 #else
     uint8_t pixels = inactive == DEFAULT_ACTIVE_COLOR ? 0xff : 0;
 
@@ -252,11 +267,38 @@ void screen_draw_codepoint(struct screen *screen, size_t row, size_t col,
         pixels = active == DEFAULT_ACTIVE_COLOR ? 0xff : 0;
     }
 
-    screen->buffer[base_offset] = pixels;
+    *buffer = pixels;
 #endif
   }
 }
 
+void screen_draw_codepoint(struct screen *screen, size_t row, size_t col,
+                           codepoint_t codepoint, enum font font, bool italic,
+                           bool underlined, bool crossedout, color_t active,
+                           color_t inactive) {
+  if (row >= ROWS)
+    return;
+
+  if (col >= COLS)
+    return;
+
+  screen->blitter->wait();
+
+  draw_glyph(screen, cell_buffer(screen, row, col), SCREEN_WIDTH_BYTES,
+             codepoint, font, underlined, crossedout, active, inactive);
+}
+
+void screen_draw_cursor(struct screen *screen, codepoint_t codepoint,
+                        enum font font, bool italic, bool underlined,
+                        bool crossedout, color_t active, color_t inactive) {
+  // Buffer on display stays intact until the overlay switches to the other
+  screen->cursor_buffer ^= 1;
+  uint8_t *buffer = screen->cursor_buffers[screen->cursor_buffer];
+
+  draw_glyph(screen, buffer, CHAR_WIDTH_BYTES, codepoint, font, underlined,
+             crossedout, active, inactive);
+}
+
 void screen_test_fonts(struct screen *screen, enum font font) {
   for (size_t row = 0; row < 24; row++) {
     for (size_t col = 0; col < 64; col++) {
@@ -288,6 +330,7 @@ static float mandelbrot(float complex z) {
 
 void screen_test_mandelbrot(struct screen *screen, float window_x,
                             float window_y, float window_r, bool (*cancel)()) {
+  screen->blitter->wait();
 
   float x_min = window_x - window_r;
   float y_min = window_y - window_r;
@@ -338,6 +381,8 @@ void screen_test_mandelbrot(struct screen *screen, float window_x,
 #define COLOR_TEST_CUBE_OFFSET 10
 
 void screen_test_colors(struct screen *screen) {
+  screen->blitter->wait();
+
   size_t line = 0;
 
   for (size_t sub_line = 0;
@@ -0,0 +1,29 @@
+#include "scroll_window.h"
+
+size_t scroll_window_line(size_t lines, size_t top_line, size_t line) {
+  line += top_line;
+
+  if (line >= lines)
+    line -= lines;
+
+  return line;
+}
+
+void scroll_window_split(uint32_t buffer, size_t line_bytes, size_t lines,
+                         size_t top_line, size_t y,
+                         struct scroll_window_layer *top_layer,
+                         struct scroll_window_layer *wrapped_layer) {
+  // Lines from top_line to the end of the buffer are shown first
+  top_layer->enabled = true;
+  top_layer->address = buffer + top_line * line_bytes;
+  top_layer->pitch = line_bytes;
+  top_layer->y = y;
+  top_layer->lines = lines - top_line;
+
+  // followed by lines wrapped to the start of the buffer
+  wrapped_layer->enabled = top_line != 0;
+  wrapped_layer->address = buffer;
+  wrapped_layer->pitch = line_bytes;
+  wrapped_layer->y = y + lines - top_line;
+  wrapped_layer->lines = top_line;
+}
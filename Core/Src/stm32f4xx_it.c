@@ -61,6 +61,7 @@
 /* External variables --------------------------------------------------------*/
 extern PCD_HandleTypeDef hpcd_USB_OTG_HS;
 extern HCD_HandleTypeDef hhcd_USB_OTG_FS;
+extern LTDC_HandleTypeDef hltdc;
 extern TIM_HandleTypeDef htim1;
 extern DMA_HandleTypeDef hdma_uart7_rx;
 extern DMA_HandleTypeDef hdma_uart7_tx;
@@ -290,9 +291,30 @@ void UART7_IRQHandler(void)
   HAL_UART_IRQHandler(&huart7);
   /* USER CODE BEGIN UART7_IRQn 1 */
 
+  // Idle flag is cleared after HAL has seen the error flags it also clears
+  if (__HAL_UART_GET_FLAG(&huart7, UART_FLAG_IDLE) &&
+      __HAL_UART_GET_IT_SOURCE(&huart7, UART_IT_IDLE)) {
+    __HAL_UART_CLEAR_IDLEFLAG(&huart7);
+    uart_receive_idle_callback();
+  }
+
   /* USER CODE END UART7_IRQn 1 */
 }
 
+/**
+  * @brief This function handles LTDC global interrupt.
+  */
+void LTDC_IRQHandler(void)
+{
+  /* USER CODE BEGIN LTDC_IRQn 0 */
+
+  /* USER CODE END LTDC_IRQn 0 */
+  HAL_LTDC_IRQHandler(&hltdc);
+  /* USER CODE BEGIN LTDC_IRQn 1 */
+
+  /* USER CODE END LTDC_IRQn 1 */
+}
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
@@ -19,6 +19,8 @@ void terminal_timer_tick(struct terminal *terminal) {
   terminal_keyboard_update_repeat_counter(terminal);
   terminal_screen_update_cursor_counter(terminal);
   terminal_screen_update_blink_counter(terminal);
+  terminal_screen_update_synchronized_output_counter(terminal);
+  terminal_uart_update_xoff_counter(terminal);
 }
 
 void terminal_init(struct terminal *terminal,
@@ -31,9 +33,9 @@ void terminal_init(struct terminal *terminal,
                    const struct terminal_config *config,
                    character_t *transmit_buffer, size_t transmit_buffer_size) {
   terminal->callbacks = callbacks;
-  terminal->default_cells = default_cells;
+  terminal->default_screen.cells = default_cells;
 #ifdef TERMINAL_ALT_CELLS
-  terminal->alt_cells = alt_cells;
+  terminal->alt_screen.cells = alt_cells;
 #endif
   terminal->tab_stops = tab_stops;
   terminal->tab_stops_size = tab_stops_size;
@@ -1,5 +1,6 @@
 #include "terminal_config_ui.h"
 
+#include <inttypes.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
@@ -329,7 +330,8 @@ static const struct terminal_ui_menu menus[] = {
                                                [PARITY_EVEN] = {"even"},
                                                [PARITY_ODD] = {"odd"},
                                                {NULL}}},
-         {NULL}}},
+         {NULL}},
+     true},
     {"Terminal",
      &(const struct terminal_ui_option[]){
          {"Character set", current_charset, change_charset,
@@ -464,6 +466,7 @@ static const char *default_help[] = {
 #define MENU_ROW 4
 #define TOP_ROW 5
 #define MAIN_ROW 8
+#define LINK_STATISTICS_ROW 15
 #define BOTTOM_ROW UI_ROWS
 
 #define LEFT_COL 1
@@ -594,6 +597,34 @@ static void render_options(struct terminal_config_ui *terminal_config_ui) {
   }
 }
 
+static void
+render_link_statistics(struct terminal_config_ui *terminal_config_ui) {
+  const struct link_statistics *link_statistics =
+      &terminal_config_ui->terminal->link_statistics;
+  const struct {
+    const char *title;
+    uint32_t value;
+  } counters[] = {
+      {"Receive ring overruns", link_statistics->ring_overruns},
+      {"Receive bytes lost", link_statistics->ring_lost},
+      {"UART overrun errors", link_statistics->overrun_errors},
+      {"Framing errors", link_statistics->framing_errors},
+      {"Parity errors", link_statistics->parity_errors},
+      {"Noise errors", link_statistics->noise_errors},
+      {"Peak receive fill", link_statistics->peak_fill},
+      {"XOFF time (ms)", link_statistics->xoff_time},
+  };
+
+  for (size_t i = 0; i < sizeof(counters) / sizeof(counters[0]); ++i) {
+    move_cursor(terminal_config_ui, i + LINK_STATISTICS_ROW, OPTIONS_COL);
+    screen_printf(terminal_config_ui, "%s:", counters[i].title);
+    move_cursor(terminal_config_ui, i + LINK_STATISTICS_ROW, CHOICES_COL);
+    screen_printf(terminal_config_ui, " %11" PRIu32, counters[i].value);
+
+    terminal_config_ui->terminal->callbacks->yield();
+  }
+}
+
 static void render_screen(struct terminal_config_ui *terminal_config_ui) {
   move_cursor(terminal_config_ui, TITLE_ROW, 30);
   screen_printf(terminal_config_ui, "\x1b[1mASCII TERMINAL SETUP\x1b[22m");
@@ -602,6 +633,9 @@ static void render_screen(struct terminal_config_ui *terminal_config_ui) {
   render_borders(terminal_config_ui);
   render_options(terminal_config_ui);
   render_help(terminal_config_ui);
+
+  if (terminal_config_ui->current_menu->link_statistics)
+    render_link_statistics(terminal_config_ui);
 }
 
 static void prev_option(struct terminal_config_ui *terminal_config_ui) {
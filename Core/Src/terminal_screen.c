@@ -1,6 +1,7 @@
 #include "terminal_internal.h"
 
 #include "luminance.h"
+#include "profile.h"
 #include <string.h>
 
 #define CURSOR_ON_COUNTER 650
@@ -9,9 +10,104 @@
 #define BLINK_ON_COUNTER 500
 #define BLINK_OFF_COUNTER 500
 
+#define SYNCHRONIZED_OUTPUT_COUNTER 200
+
 #define CELL_SIZE sizeof(struct visual_cell)
 #define CELLS_ROW_SIZE (CELL_SIZE * COLS)
 #define CELLS_SIZE (CELLS_ROW_SIZE * ROWS)
+#define CELLS_ROW_POINTER_SIZE sizeof(struct visual_cell *)
+
+#define VISUAL_PROPS_SIZE sizeof(struct visual_props)
+
+#define DIRTY_BIT(n) ((uint32_t)1 << ((n) % DIRTY_WORD_BITS))
+
+static inline bool is_dirty(struct terminal *terminal, int16_t row,
+                            int16_t col) {
+  return terminal->dirty_cols[row][col / DIRTY_WORD_BITS] & DIRTY_BIT(col);
+}
+
+static inline void mark_dirty(struct terminal *terminal, int16_t row,
+                              int16_t col) {
+  terminal->dirty_cols[row][col / DIRTY_WORD_BITS] |= DIRTY_BIT(col);
+  terminal->dirty_rows |= DIRTY_BIT(row);
+}
+
+static inline void clear_dirty(struct terminal *terminal, int16_t row,
+                               int16_t col) {
+  terminal->dirty_cols[row][col / DIRTY_WORD_BITS] &= ~DIRTY_BIT(col);
+}
+
+static void mark_dirty_cols(struct terminal *terminal, int16_t row,
+                            int16_t from_col, int16_t to_col) {
+  for (int16_t col = from_col; col < to_col; ++col)
+    mark_dirty(terminal, row, col);
+}
+
+static void mark_dirty_rows(struct terminal *terminal, int16_t from_row,
+                            int16_t to_row) {
+  for (int16_t row = from_row; row < to_row; ++row)
+    mark_dirty_cols(terminal, row, 0, COLS);
+}
+
+// Frame changes only go to cells until the host ends the frame or the
+// timeout runs out
+static bool output_held(struct terminal *terminal) {
+  return terminal->synchronized_output_mode &&
+         terminal->synchronized_output_counter;
+}
+
+static void copy_dirty_row(struct terminal *terminal, int16_t to_row,
+                           int16_t from_row) {
+  memcpy(terminal->dirty_cols[to_row], terminal->dirty_cols[from_row],
+         sizeof(terminal->dirty_cols[to_row]));
+
+  if (terminal->dirty_rows & DIRTY_BIT(from_row))
+    terminal->dirty_rows |= DIRTY_BIT(to_row);
+}
+
+static void copy_dirty_col(struct terminal *terminal, int16_t row,
+                           int16_t to_col, int16_t from_col) {
+  if (is_dirty(terminal, row, from_col))
+    mark_dirty(terminal, row, to_col);
+  else
+    clear_dirty(terminal, row, to_col);
+}
+
+struct visual_cell *get_cell(struct terminal *terminal, int16_t row,
+                             int16_t col) {
+  return &terminal->screen->rows[row][col];
+}
+
+static inline const struct visual_props *
+get_props(struct terminal *terminal, const struct visual_cell *cell) {
+  return &cell->p;
+}
+
+static inline bool is_blink(struct terminal *terminal, int16_t row,
+                            int16_t col) {
+  return get_props(terminal, get_cell(terminal, row, col))->blink;
+}
+
+static void count_blink_cells(struct terminal *terminal, int16_t row) {
+  uint8_t count = 0;
+
+  for (int16_t col = 0; col < COLS; ++col)
+    count += is_blink(terminal, row, col);
+
+  terminal->screen->blink_cells[row] = count;
+}
+
+static bool equal_props(const struct visual_props *props1,
+                        const struct visual_props *props2) {
+  return memcmp(props1, props2, VISUAL_PROPS_SIZE) == 0;
+}
+
+static struct visual_props get_cleared_props(struct terminal *terminal) {
+  return (struct visual_props){
+      .active_color = terminal->vs.p.active_color,
+      .inactive_color = terminal->vs.p.inactive_color,
+  };
+}
 
 static void clear_cells_rows(struct terminal *terminal, int16_t from_row,
                              int16_t to_row) {
@@ -22,15 +118,19 @@ static void clear_cells_rows(struct terminal *terminal, int16_t from_row,
     return;
 
   uint16_t rows = to_row - from_row;
-  size_t offset = from_row * COLS;
-  struct visual_cell *cells = terminal->cells + offset;
+  struct visual_props p = get_cleared_props(terminal);
+  struct visual_screen *screen = terminal->screen;
 
   for (uint16_t i = 0; i < rows; ++i) {
-    memset(cells, 0, CELLS_ROW_SIZE);
+    struct visual_cell *cells = screen->rows[from_row + i];
+
+    memset(terminal->dirty_cols[from_row + i], 0,
+           sizeof(terminal->dirty_cols[from_row + i]));
+    screen->blink_cells[from_row + i] = 0;
 
     for (size_t k = 0; k < COLS; ++k, cells++) {
-      cells->p.active_color = terminal->vs.p.active_color;
-      cells->p.inactive_color = terminal->vs.p.inactive_color;
+      cells->c = 0;
+      cells->p = p;
     }
 
     terminal->callbacks->yield();
@@ -48,15 +148,19 @@ static void clear_cells_cols(struct terminal *terminal, int16_t row,
   if (to_col > COLS)
     return;
 
-  size_t offset = row * COLS + from_col;
-  struct visual_cell *cells = terminal->cells + offset;
-
-  memset(cells, 0, CELL_SIZE * (to_col - from_col));
+  struct visual_screen *screen = terminal->screen;
+  struct visual_cell *cells = screen->rows[row] + from_col;
+  struct visual_props p = get_cleared_props(terminal);
 
   for (size_t i = 0; i < (to_col - from_col); ++i, cells++) {
-    cells->p.active_color = terminal->vs.p.active_color;
-    cells->p.inactive_color = terminal->vs.p.inactive_color;
+    cells->c = 0;
+    cells->p = p;
+
+    clear_dirty(terminal, row, from_col + i);
   }
+
+  if (screen->blink_cells[row])
+    count_blink_cells(terminal, row);
 }
 
 static void scroll_cells(struct terminal *terminal, enum scroll scroll,
@@ -72,29 +176,32 @@ static void scroll_cells(struct terminal *terminal, enum scroll scroll,
     return;
   }
 
-  size_t disp = COLS * rows;
   uint16_t rows_diff = to_row - from_row - rows;
+  struct visual_cell **cells_rows = terminal->screen->rows;
+  uint8_t *blink_cells = terminal->screen->blink_cells;
+  struct visual_cell *tmp[TERMINAL_MAX_ROWS];
 
+  // Rows leaving the region are rotated to the other end and cleared
   if (scroll == SCROLL_DOWN) {
-    size_t offset = COLS * to_row - COLS;
-    struct visual_cell *cells = terminal->cells + offset;
-
-    for (uint16_t i = 0; i < rows_diff; ++i, cells -= COLS) {
-      memcpy(cells, cells - disp, CELLS_ROW_SIZE);
+    memcpy(tmp, cells_rows + to_row - rows, CELLS_ROW_POINTER_SIZE * rows);
+    memmove(cells_rows + from_row + rows, cells_rows + from_row,
+            CELLS_ROW_POINTER_SIZE * rows_diff);
+    memcpy(cells_rows + from_row, tmp, CELLS_ROW_POINTER_SIZE * rows);
+    memmove(blink_cells + from_row + rows, blink_cells + from_row, rows_diff);
 
-      terminal->callbacks->yield();
-    }
+    for (uint16_t i = 0; i < rows_diff; ++i)
+      copy_dirty_row(terminal, to_row - 1 - i, to_row - 1 - i - rows);
 
     clear_cells_rows(terminal, from_row, from_row + rows);
   } else if (scroll == SCROLL_UP) {
-    size_t offset = COLS * from_row;
-    struct visual_cell *cells = terminal->cells + offset;
+    memcpy(tmp, cells_rows + from_row, CELLS_ROW_POINTER_SIZE * rows);
+    memmove(cells_rows + from_row, cells_rows + from_row + rows,
+            CELLS_ROW_POINTER_SIZE * rows_diff);
+    memcpy(cells_rows + to_row - rows, tmp, CELLS_ROW_POINTER_SIZE * rows);
+    memmove(blink_cells + from_row, blink_cells + from_row + rows, rows_diff);
 
-    for (uint16_t i = 0; i < rows_diff; ++i, cells += COLS) {
-      memcpy(cells, cells + disp, CELLS_ROW_SIZE);
-
-      terminal->callbacks->yield();
-    }
+    for (uint16_t i = 0; i < rows_diff; ++i)
+      copy_dirty_row(terminal, from_row + i, from_row + i + rows);
 
     clear_cells_rows(terminal, to_row - rows, to_row);
   }
@@ -112,14 +219,16 @@ static void shift_cells_right(struct terminal *terminal, int16_t row,
     return;
 
   size_t size = CELL_SIZE * (COLS - col - cols);
-  size_t offset = COLS * row + col;
-  struct visual_cell *cells = terminal->cells + offset;
+  struct visual_cell *cells = terminal->screen->rows[row] + col;
 
   struct visual_cell tmp[COLS];
 
   memcpy(tmp, cells, size);
   memcpy(cells + cols, tmp, size);
 
+  for (int16_t i = COLS - 1; i >= (int16_t)(col + cols); --i)
+    copy_dirty_col(terminal, row, i, i - cols);
+
   clear_cells_cols(terminal, row, col, col + cols);
 }
 
@@ -135,17 +244,14 @@ static void shift_cells_left(struct terminal *terminal, int16_t row,
     return;
 
   size_t size = CELL_SIZE * (COLS - col - cols);
-  size_t offset = COLS * row + col;
-  struct visual_cell *cells = terminal->cells + offset;
+  struct visual_cell *cells = terminal->screen->rows[row] + col;
 
   memcpy(cells, cells + cols, size);
 
-  clear_cells_cols(terminal, row, COLS - cols, COLS);
-}
+  for (int16_t i = col; i < (int16_t)(COLS - cols); ++i)
+    copy_dirty_col(terminal, row, i, i + cols);
 
-struct visual_cell *get_cell(struct terminal *terminal, int16_t row,
-                             int16_t col) {
-  return &terminal->cells[row * COLS + col];
+  clear_cells_cols(terminal, row, COLS - cols, COLS);
 }
 
 static void swap_colors(color_t *color1, color_t *color2) {
@@ -176,14 +282,16 @@ static void to_monochrome(struct terminal *terminal, color_t *active, color_t *i
 }
 #endif
 
-static void render_character(struct terminal *terminal, int16_t row,
-                             int16_t col, bool cursor, bool blink) {
-  struct visual_cell *cell = get_cell(terminal, row, col);
+// Props with the colors a cell is drawn in
+static struct visual_props render_props(struct terminal *terminal,
+                                        struct visual_cell *cell, bool cursor,
+                                        bool blink) {
+  struct visual_props props = *get_props(terminal, cell);
 
-  color_t active = cell->p.active_color;
-  color_t inactive = cell->p.inactive_color;
+  color_t active = props.active_color;
+  color_t inactive = props.inactive_color;
 
-  if (cell->p.negative != terminal->screen_mode)
+  if (props.negative)
     swap_colors(&active, &inactive);
 
   if (cursor) {
@@ -191,7 +299,7 @@ static void render_character(struct terminal *terminal, int16_t row,
     inactive = ~inactive;
   }
 
-  if (terminal->vs.p.concealed || blink) {
+  if (props.concealed || blink) {
     active = inactive;
   }
 
@@ -199,62 +307,81 @@ static void render_character(struct terminal *terminal, int16_t row,
   to_monochrome(terminal, &active, &inactive);
 #endif
 
-  terminal->callbacks->screen_draw_codepoint(
-      terminal->format, row, col, cell->c, cell->p.font, cell->p.italic,
-      cell->p.underlined, cell->p.crossedout, active, inactive);
-}
-
-static void draw_cursor(struct terminal *terminal) {
-  if (!terminal->cursor_drawn) {
-    render_character(
-        terminal, terminal->vs.cursor_row, terminal->vs.cursor_col, true,
-        terminal->blink_drawn &&
-            get_cell(terminal, terminal->vs.cursor_row, terminal->vs.cursor_col)
-                ->p.blink);
-    terminal->cursor_drawn = true;
-  }
+  props.active_color = active;
+  props.inactive_color = inactive;
+  return props;
 }
 
-static void clear_cursor(struct terminal *terminal) {
-  if (terminal->cursor_drawn) {
-    render_character(
-        terminal, terminal->vs.cursor_row, terminal->vs.cursor_col, false,
-        terminal->blink_drawn &&
-            get_cell(terminal, terminal->vs.cursor_row, terminal->vs.cursor_col)
-                ->p.blink);
-    terminal->cursor_drawn = false;
-  }
+static void render_character(struct terminal *terminal, int16_t row,
+                             int16_t col, bool blink) {
+  PROFILE_BEGIN(PROFILE_RENDER_CHARACTER);
+
+  struct visual_cell *cell = get_cell(terminal, row, col);
+  struct visual_props props = render_props(terminal, cell, false, blink);
+
+  terminal->callbacks->screen_draw_codepoint(
+      terminal->format, row, col, cell->c, props.font, props.italic,
+      props.underlined, props.crossedout, props.active_color,
+      props.inactive_color);
+
+  clear_dirty(terminal, row, col);
+
+  PROFILE_END(PROFILE_RENDER_CHARACTER);
 }
 
+// Cursor is an overlay that is redrawn only when the cell under it looks
+// different and otherwise just moved, shown or hidden
 static void update_cursor(struct terminal *terminal) {
-  if (terminal->cursor_on) {
-    draw_cursor(terminal);
-  } else {
-    clear_cursor(terminal);
+  struct cursor_overlay *overlay = &terminal->cursor_overlay;
+
+  if (!terminal->cursor_on) {
+    if (overlay->shown) {
+      terminal->callbacks->screen_hide_cursor(terminal->format);
+      overlay->shown = false;
+    }
+
+    return;
+  }
+
+  int16_t row = terminal->vs.cursor_row;
+  int16_t col = terminal->vs.cursor_col;
+  struct visual_cell *cell = get_cell(terminal, row, col);
+  bool blink = terminal->blink_drawn && is_blink(terminal, row, col);
+  struct visual_props props = render_props(terminal, cell, true, blink);
+
+  if (!overlay->drawn || overlay->c != cell->c ||
+      !equal_props(&overlay->p, &props)) {
+    terminal->callbacks->screen_draw_cursor(
+        terminal->format, cell->c, props.font, props.italic, props.underlined,
+        props.crossedout, props.active_color, props.inactive_color);
+
+    overlay->drawn = true;
+    overlay->shown = false;
+    overlay->c = cell->c;
+    overlay->p = props;
+  }
+
+  if (!overlay->shown || overlay->row != row || overlay->col != col) {
+    terminal->callbacks->screen_show_cursor(terminal->format, row, col);
+
+    overlay->shown = true;
+    overlay->row = row;
+    overlay->col = col;
   }
 }
 
 static void draw_blink(struct terminal *terminal, bool blink) {
   if (terminal->blink_drawn != blink) {
     for (int16_t row = 0; row < ROWS; ++row)
-      for (int16_t col = 0; col < COLS; ++col)
-        if (get_cell(terminal, row, col)->p.blink)
-          render_character(terminal, row, col,
-                           terminal->cursor_drawn &&
-                               terminal->vs.cursor_row == row &&
-                               terminal->vs.cursor_col == col,
-                           blink);
+      if (terminal->screen->blink_cells[row])
+        for (int16_t col = 0; col < COLS; ++col)
+          if (is_blink(terminal, row, col))
+            render_character(terminal, row, col, blink);
 
     terminal->blink_drawn = blink;
   }
 }
 
-static void clear_blink(struct terminal *terminal) {
-  if (terminal->blink_drawn) {
-    draw_blink(terminal, false);
-  }
-}
-
 static void update_blink(struct terminal *terminal) {
   draw_blink(terminal, terminal->blink_on);
 }
@@ -262,40 +389,64 @@ static void update_blink(struct terminal *terminal) {
 static void draw_codepoint(struct terminal *terminal, codepoint_t codepoint) {
   struct visual_cell *cell =
       get_cell(terminal, terminal->vs.cursor_row, terminal->vs.cursor_col);
+  uint8_t *blink_cells =
+      &terminal->screen->blink_cells[terminal->vs.cursor_row];
+
+  *blink_cells += terminal->vs.p.blink - cell->p.blink;
 
-  cell->p = terminal->vs.p;
   cell->c = codepoint;
+  cell->p = terminal->vs.p;
+
+  mark_dirty(terminal, terminal->vs.cursor_row, terminal->vs.cursor_col);
+}
 
-  render_character(terminal, terminal->vs.cursor_row, terminal->vs.cursor_col,
-                   terminal->cursor_drawn,
-                   terminal->blink_drawn && cell->p.blink);
+static void render_cell(struct terminal *terminal, int16_t row, int16_t col) {
+  render_character(terminal, row, col,
+                   terminal->blink_drawn && is_blink(terminal, row, col));
 }
 
 static void draw_screen(struct terminal *terminal) {
   for (int16_t row = 0; row < ROWS; ++row)
-    for (int16_t col = 0; col < COLS; ++col) {
-      struct visual_cell *cell = get_cell(terminal, row, col);
-      render_character(terminal, row, col,
-                       terminal->cursor_drawn &&
-                           terminal->vs.cursor_row == row &&
-                           terminal->vs.cursor_col == col,
-                       terminal->blink_drawn && cell->p.blink);
+    for (int16_t col = 0; col < COLS; ++col)
+      render_cell(terminal, row, col);
+}
+
+static void draw_dirty(struct terminal *terminal) {
+  while (terminal->dirty_rows) {
+    int16_t row = __builtin_ctz(terminal->dirty_rows);
+    terminal->dirty_rows &= ~DIRTY_BIT(row);
+
+    for (size_t word = 0; word < DIRTY_ROW_WORDS; ++word) {
+      uint32_t bits;
+
+      while ((bits = terminal->dirty_cols[row][word]))
+        render_cell(terminal, row,
+                    word * DIRTY_WORD_BITS + __builtin_ctz(bits));
     }
+
+    terminal->callbacks->yield();
+  }
 }
 
 static color_t inactive_color(struct terminal *terminal) {
-  color_t active = terminal->vs.p.active_color;
   color_t inactive = terminal->vs.p.inactive_color;
 
 #ifndef TERMINAL_8BIT_COLOR
+  color_t active = terminal->vs.p.active_color;
   to_monochrome(terminal, &active, &inactive);
 #endif
 
-  return terminal->screen_mode ? active : inactive;
+  return inactive;
 }
 
 static void clear_rows(struct terminal *terminal, int16_t from_row,
                        int16_t to_row) {
+  if (output_held(terminal)) {
+    clear_cells_rows(terminal, from_row, to_row);
+    mark_dirty_rows(terminal, from_row, to_row);
+    return;
+  }
+
   terminal->callbacks->screen_clear_rows(terminal->format, from_row, to_row,
                                          inactive_color(terminal));
 
@@ -304,6 +455,12 @@ static void clear_rows(struct terminal *terminal, int16_t from_row,
 
 static void clear_cols(struct terminal *terminal, int16_t row, int16_t from_col,
                        int16_t to_col) {
+  if (output_held(terminal)) {
+    clear_cells_cols(terminal, row, from_col, to_col);
+    mark_dirty_cols(terminal, row, from_col, to_col);
+    return;
+  }
+
   terminal->callbacks->screen_clear_cols(terminal->format, row, from_col,
                                          to_col, inactive_color(terminal));
 
@@ -313,6 +470,12 @@ static void clear_cols(struct terminal *terminal, int16_t row, int16_t from_col,
 static void screen_scroll(struct terminal *terminal, enum scroll scroll,
                           int16_t from_row, int16_t rows) {
   if (from_row < terminal->margin_bottom) {
+    if (output_held(terminal)) {
+      scroll_cells(terminal, scroll, from_row, terminal->margin_bottom, rows);
+      mark_dirty_rows(terminal, from_row, terminal->margin_bottom);
+      return;
+    }
+
     terminal->callbacks->screen_scroll(terminal->format, scroll, from_row,
                                        terminal->margin_bottom, rows,
                                        inactive_color(terminal));
@@ -328,8 +491,6 @@ static bool inside_margins(struct terminal *terminal) {
 
 void terminal_screen_move_cursor_absolute(struct terminal *terminal,
                                           int16_t row, int16_t col) {
-  clear_cursor(terminal);
-
   if (terminal->origin_mode) {
     row = terminal->margin_top + row;
 
@@ -355,8 +516,6 @@ void terminal_screen_move_cursor_absolute(struct terminal *terminal,
   terminal->vs.cursor_row = row;
   terminal->vs.cursor_col = col;
   terminal->vs.cursor_last_col = false;
-
-  update_cursor(terminal);
 }
 
 int16_t get_terminal_screen_cursor_row(struct terminal *terminal) {
@@ -370,8 +529,6 @@ int16_t get_terminal_screen_cursor_col(struct terminal *terminal) {
 
 void terminal_screen_move_cursor(struct terminal *terminal, int16_t rows,
                                  int16_t cols) {
-  clear_cursor(terminal);
-
   int16_t row = terminal->vs.cursor_row + rows;
   int16_t col = terminal->vs.cursor_col + cols;
 
@@ -398,107 +555,53 @@ void terminal_screen_move_cursor(struct terminal *terminal, int16_t rows,
   terminal->vs.cursor_row = row;
   terminal->vs.cursor_col = col;
   terminal->vs.cursor_last_col = false;
-
-  update_cursor(terminal);
 }
 
 void terminal_screen_carriage_return(struct terminal *terminal) {
-  clear_cursor(terminal);
-
   terminal->vs.cursor_col = 0;
   terminal->vs.cursor_last_col = false;
-
-  update_cursor(terminal);
 }
 
 void terminal_screen_scroll(struct terminal *terminal, enum scroll scroll,
                             size_t from_row, size_t rows) {
-  clear_cursor(terminal);
-  clear_blink(terminal);
-
   if (terminal->origin_mode) {
     from_row = terminal->margin_top + from_row;
   }
 
   screen_scroll(terminal, scroll, from_row, rows);
-
-  update_cursor(terminal);
-  update_blink(terminal);
 }
 
 void terminal_screen_clear_to_right(struct terminal *terminal) {
-  clear_blink(terminal);
-  clear_cursor(terminal);
-
   clear_cols(terminal, terminal->vs.cursor_row, terminal->vs.cursor_col, COLS);
-
-  update_cursor(terminal);
-  update_blink(terminal);
 }
 
 void terminal_screen_clear_to_left(struct terminal *terminal) {
-  clear_blink(terminal);
-  clear_cursor(terminal);
-
   clear_cols(terminal, terminal->vs.cursor_row, 0, terminal->vs.cursor_col + 1);
-
-  update_cursor(terminal);
-  update_blink(terminal);
 }
 
 void terminal_screen_clear_to_top(struct terminal *terminal) {
-  clear_blink(terminal);
-  clear_cursor(terminal);
-
   clear_rows(terminal, 0, terminal->vs.cursor_row);
-
-  update_cursor(terminal);
-  update_blink(terminal);
 }
 
 void terminal_screen_clear_row(struct terminal *terminal) {
-  clear_blink(terminal);
-  clear_cursor(terminal);
-
   clear_cols(terminal, terminal->vs.cursor_row, 0, COLS);
-
-  update_cursor(terminal);
-  update_blink(terminal);
 }
 
 void terminal_screen_clear_to_bottom(struct terminal *terminal) {
-  clear_blink(terminal);
-  clear_cursor(terminal);
-
   clear_rows(terminal, terminal->vs.cursor_row + 1, ROWS);
-
-  update_cursor(terminal);
-  update_blink(terminal);
 }
 
 void terminal_screen_clear_all(struct terminal *terminal) {
-  clear_blink(terminal);
-  clear_cursor(terminal);
-
   clear_rows(terminal, 0, ROWS);
-
-  update_cursor(terminal);
-  update_blink(terminal);
 }
 
 void terminal_screen_index(struct terminal *terminal, int16_t rows) {
-  clear_cursor(terminal);
-
   if (inside_margins(terminal)) {
     if (terminal->vs.cursor_row + rows >= terminal->margin_bottom) {
-      clear_blink(terminal);
-
       screen_scroll(
           terminal, SCROLL_UP, terminal->margin_top,
           rows - (terminal->margin_bottom - 1 - terminal->vs.cursor_row));
       terminal->vs.cursor_row = terminal->margin_bottom - 1;
-
-      update_blink(terminal);
     } else
       terminal->vs.cursor_row += rows;
 
@@ -508,20 +611,14 @@ void terminal_screen_index(struct terminal *terminal, int16_t rows) {
         terminal, terminal->vs.cursor_row + rows, terminal->vs.cursor_col);
 
   terminal->vs.cursor_last_col = false;
-  update_cursor(terminal);
 }
 
 void terminal_screen_reverse_index(struct terminal *terminal, int16_t rows) {
-  clear_cursor(terminal);
   if (inside_margins(terminal)) {
     if (terminal->vs.cursor_row - rows < terminal->margin_top) {
-      clear_blink(terminal);
-
       screen_scroll(terminal, SCROLL_DOWN, terminal->margin_top,
                     rows - (terminal->vs.cursor_row - terminal->margin_top));
       terminal->vs.cursor_row = terminal->margin_top;
-
-      update_blink(terminal);
     } else
       terminal->vs.cursor_row -= rows;
 
@@ -529,13 +626,11 @@ void terminal_screen_reverse_index(struct terminal *terminal, int16_t rows) {
   } else
     terminal_screen_move_cursor_absolute(
         terminal, terminal->vs.cursor_row - rows, terminal->vs.cursor_col);
-
-  update_cursor(terminal);
 }
 
 void terminal_screen_wrap_last_col(struct terminal *terminal) {
   if (terminal->vs.cursor_last_col) {
-    terminal_screen_carriage_return(terminal);
+    terminal->vs.cursor_col = 0;
     terminal_screen_index(terminal, 1);
     terminal->vs.cursor_last_col = false;
   }
@@ -545,29 +640,14 @@ void terminal_screen_cancel_wrap_last_col(struct terminal *terminal) {
   terminal->vs.cursor_last_col = false;
 }
 
-void terminal_screen_put_codepoint(struct terminal *terminal,
-                                   codepoint_t codepoint) {
-  terminal_screen_wrap_last_col(terminal);
-
-  if (terminal->insert_mode)
-    terminal_screen_insert(terminal, 1);
-
-  clear_cursor(terminal);
-
-  draw_codepoint(terminal, codepoint);
-
-  if (terminal->vs.cursor_col == COLS - 1) {
-    if (terminal->auto_wrap_mode)
-      terminal->vs.cursor_last_col = true;
-  } else
-    terminal->vs.cursor_col++;
-
-  update_cursor(terminal);
-}
-
 void terminal_screen_insert(struct terminal *terminal, size_t cols) {
-  clear_cursor(terminal);
-  clear_blink(terminal);
+  if (output_held(terminal)) {
+    shift_cells_right(terminal, terminal->vs.cursor_row,
+                      terminal->vs.cursor_col, cols);
+    mark_dirty_cols(terminal, terminal->vs.cursor_row, terminal->vs.cursor_col,
+                    COLS);
+    return;
+  }
 
   terminal->callbacks->screen_shift_right(
       terminal->format, terminal->vs.cursor_row, terminal->vs.cursor_col, cols,
@@ -575,14 +655,54 @@ void terminal_screen_insert(struct terminal *terminal, size_t cols) {
 
   shift_cells_right(terminal, terminal->vs.cursor_row, terminal->vs.cursor_col,
                     cols);
+}
 
-  update_cursor(terminal);
-  update_blink(terminal);
+void terminal_screen_put_codepoints(struct terminal *terminal,
+                                    const codepoint_t *codepoints,
+                                    size_t count) {
+  while (count) {
+    terminal_screen_wrap_last_col(terminal);
+
+    size_t cols = COLS - terminal->vs.cursor_col;
+    if (cols > count)
+      cols = count;
+
+    if (terminal->insert_mode)
+      terminal_screen_insert(terminal, cols);
+
+    for (size_t i = 0; i < cols; ++i) {
+      draw_codepoint(terminal, *codepoints++);
+
+      if (terminal->vs.cursor_col == COLS - 1) {
+        if (terminal->auto_wrap_mode)
+          terminal->vs.cursor_last_col = true;
+      } else
+        terminal->vs.cursor_col++;
+    }
+
+    count -= cols;
+
+    // Without auto-wrap the rest of the run overwrites the last column
+    if (count && !terminal->vs.cursor_last_col) {
+      codepoints += count - 1;
+      count = 1;
+    }
+  }
+}
+
+void terminal_screen_put_codepoint(struct terminal *terminal,
+                                   codepoint_t codepoint) {
+  terminal_screen_put_codepoints(terminal, &codepoint, 1);
 }
 
 void terminal_screen_delete(struct terminal *terminal, size_t cols) {
-  clear_cursor(terminal);
-  clear_blink(terminal);
+  if (output_held(terminal)) {
+    shift_cells_left(terminal, terminal->vs.cursor_row,
+                     terminal->vs.cursor_col, cols);
+    mark_dirty_cols(terminal, terminal->vs.cursor_row, terminal->vs.cursor_col,
+                    COLS);
+    return;
+  }
 
   terminal->callbacks->screen_shift_left(
       terminal->format, terminal->vs.cursor_row, terminal->vs.cursor_col, cols,
@@ -590,25 +710,14 @@ void terminal_screen_delete(struct terminal *terminal, size_t cols) {
 
   shift_cells_left(terminal, terminal->vs.cursor_row, terminal->vs.cursor_col,
                    cols);
-
-  update_cursor(terminal);
-  update_blink(terminal);
 }
 
 void terminal_screen_erase(struct terminal *terminal, size_t cols) {
-  clear_cursor(terminal);
-  clear_blink(terminal);
-
   clear_cols(terminal, terminal->vs.cursor_row, terminal->vs.cursor_col,
              terminal->vs.cursor_col + cols);
-
-  update_cursor(terminal);
-  update_blink(terminal);
 }
 
 void terminal_screen_enable_cursor(struct terminal *terminal, bool enable) {
-  clear_cursor(terminal);
-
   if (enable) {
     terminal->cursor_counter = CURSOR_ON_COUNTER;
     terminal->cursor_on = true;
@@ -616,8 +725,6 @@ void terminal_screen_enable_cursor(struct terminal *terminal, bool enable) {
     terminal->cursor_counter = 0;
     terminal->cursor_on = false;
   }
-
-  update_cursor(terminal);
 }
 
 void terminal_screen_save_visual_state(struct terminal *terminal) {
@@ -625,8 +732,6 @@ void terminal_screen_save_visual_state(struct terminal *terminal) {
 }
 
 void terminal_screen_restore_visual_state(struct terminal *terminal) {
-  clear_cursor(terminal);
-
   terminal->vs = terminal->saved_vs;
 
   if (terminal->origin_mode) {
@@ -636,8 +741,6 @@ void terminal_screen_restore_visual_state(struct terminal *terminal) {
     if (terminal->vs.cursor_row >= terminal->margin_bottom)
       terminal->vs.cursor_row = terminal->margin_bottom - 1;
   }
-
-  update_cursor(terminal);
 }
 
 void terminal_screen_update_cursor_counter(struct terminal *terminal) {
@@ -672,27 +775,84 @@ void terminal_screen_update_blink_counter(struct terminal *terminal) {
   }
 }
 
+void terminal_screen_update_synchronized_output_counter(
+    struct terminal *terminal) {
+  if (terminal->synchronized_output_counter)
+    terminal->synchronized_output_counter--;
+}
+
+// Palette changes since the last update are loaded at once
+static void update_palette(struct terminal *terminal) {
+  if (terminal->palette_dirty) {
+    terminal->callbacks->screen_set_palette(terminal->format,
+                                            terminal->palette);
+    terminal->palette_dirty = false;
+  }
+}
+
 void terminal_screen_update(struct terminal *terminal) {
-  update_cursor(terminal);
+  if (output_held(terminal))
+    return;
+
+  update_palette(terminal);
+  draw_dirty(terminal);
   update_blink(terminal);
+  update_cursor(terminal);
 }
 
 void terminal_screen_set_screen_mode(struct terminal *terminal, bool mode) {
   if (terminal->screen_mode != mode) {
     terminal->screen_mode = mode;
-    draw_screen(terminal);
+    terminal->callbacks->screen_set_mode(terminal->format, mode);
+  }
+}
+
+void terminal_screen_set_synchronized_output_mode(struct terminal *terminal,
+                                                  bool mode) {
+  terminal->synchronized_output_mode = mode;
+
+  if (mode)
+    terminal->synchronized_output_counter = SYNCHRONIZED_OUTPUT_COUNTER;
+}
+
+void terminal_screen_set_color(struct terminal *terminal, color_t color,
+                               rgb_t rgb) {
+  if (terminal->palette[color] != rgb) {
+    terminal->palette[color] = rgb;
+    terminal->palette_dirty = true;
   }
 }
 
+void terminal_screen_reset_color(struct terminal *terminal, color_t color) {
+  terminal_screen_set_color(terminal, color, rgb_table[color]);
+}
+
+void terminal_screen_reset_palette(struct terminal *terminal) {
+  memcpy(terminal->palette, rgb_table, sizeof(terminal->palette));
+  terminal->palette_dirty = true;
+}
+
+static void init_visual_screen(struct terminal *terminal,
+                               struct visual_screen *screen) {
+  for (int16_t row = 0; row < ROWS; ++row)
+    screen->rows[row] = screen->cells + row * COLS;
+
+  memset(screen->blink_cells, 0, sizeof(screen->blink_cells));
+}
+
 #ifdef TERMINAL_ALT_CELLS
 void terminal_screen_use_alt_cells(struct terminal *terminal) {
-  terminal->cells = terminal->alt_cells;
+  terminal->screen = &terminal->alt_screen;
   terminal_screen_clear_all(terminal);
 }
 
 void terminal_screen_restore_default_cells(struct terminal *terminal) {
-  terminal->cells = terminal->default_cells;
-  draw_screen(terminal);
+  terminal->screen = &terminal->default_screen;
+
+  if (output_held(terminal))
+    mark_dirty_rows(terminal, 0, ROWS);
+  else
+    draw_screen(terminal);
 }
 #endif
 
@@ -718,13 +878,26 @@ void terminal_screen_init(struct terminal *terminal) {
 
   terminal->cursor_counter = CURSOR_ON_COUNTER;
   terminal->cursor_on = true;
-  terminal->cursor_drawn = false;
+  terminal->cursor_overlay.drawn = false;
+  terminal->cursor_overlay.shown = false;
+
+  terminal->callbacks->screen_set_mode(terminal->format, terminal->screen_mode);
+  terminal_screen_reset_palette(terminal);
 
   terminal->blink_counter = BLINK_ON_COUNTER;
   terminal->blink_on = true;
   terminal->blink_drawn = false;
 
-  terminal->cells = terminal->default_cells;
+  terminal->synchronized_output_mode = false;
+  terminal->synchronized_output_counter = 0;
+
+  terminal->dirty_rows = 0;
+
+  init_visual_screen(terminal, &terminal->default_screen);
+#ifdef TERMINAL_ALT_CELLS
+  init_visual_screen(terminal, &terminal->alt_screen);
+#endif
+
+  terminal->screen = &terminal->default_screen;
   terminal_screen_clear_all(terminal);
-  update_cursor(terminal);
 }
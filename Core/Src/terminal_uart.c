@@ -1,10 +1,14 @@
 #include "terminal_internal.h"
 
+#include "color_table.h"
+#include "profile.h"
+
+#include <inttypes.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
 
-#define PRINTF_BUFFER_SIZE 64
+#define PRINTF_BUFFER_SIZE 128
 
 #define DECRQSS_PREFIX "$q"
 #define DECRQSS_PREFIX_LENGTH 2
@@ -12,35 +16,49 @@
 #define XOFF_LIMIT 256
 #define XON_LIMIT 128
 
-#define DEFAULT_RECEIVE CHARACTER_MAX
+// Private DECDSR request reporting link statistics
+#define DSR_LINK_STATISTICS 900
+
+#define RECEIVE_RUN_LENGTH 80
 
 static void clear_esc_params(struct terminal *terminal) {
-  memset(terminal->esc_params, 0, ESC_MAX_PARAMS_COUNT * ESC_MAX_PARAM_LENGTH);
+  terminal->esc_params_given = 0;
+  terminal->esc_params_sub = 0;
   terminal->esc_params_count = 0;
-  terminal->esc_last_param_length = 0;
+  terminal->esc_private = 0;
+  terminal->esc_intermediate = 0;
   terminal->vt52_move_cursor_row = 0;
 }
 
-static int16_t get_esc_param(struct terminal *terminal, size_t index) {
-  return atoi((const char *)terminal->esc_params[index]);
+static bool is_esc_param_given(struct terminal *terminal, size_t index) {
+  return index < ESC_MAX_PARAMS_COUNT &&
+         (terminal->esc_params_given & (1 << index));
 }
 
-static const receive_table_t utf8_prefix_receive_table;
-static const receive_table_t utf8_continuation_receive_table;
-static const receive_table_t one_byte_receive_table;
+static bool is_esc_sub_param(struct terminal *terminal, size_t index) {
+  return index < ESC_MAX_PARAMS_COUNT &&
+         (terminal->esc_params_sub & (1 << index));
+}
 
-static bool codepoint_receive_table(struct terminal *terminal) {
-  return (terminal->receive_table == &utf8_prefix_receive_table ||
-          terminal->receive_table == &utf8_continuation_receive_table ||
-          terminal->receive_table == &one_byte_receive_table);
+// Parameters without digits default to zero
+static uint16_t get_esc_param(struct terminal *terminal, size_t index) {
+  return is_esc_param_given(terminal, index) ? terminal->esc_params[index]
+                                             : 0;
 }
 
-static void clear_receive_table(struct terminal *terminal) {
-  if (terminal->charset == CHARSET_UTF8)
-    terminal->receive_table = &utf8_prefix_receive_table;
-  else
-    terminal->receive_table = &one_byte_receive_table;
+static size_t get_esc_params_count(struct terminal *terminal) {
+  return terminal->esc_params_count < ESC_MAX_PARAMS_COUNT
+             ? terminal->esc_params_count
+             : ESC_MAX_PARAMS_COUNT;
+}
+
+static bool codepoint_receive_state(struct terminal *terminal) {
+  return (terminal->receive_state == RECEIVE_GROUND ||
+          terminal->receive_state == RECEIVE_UTF8);
+}
 
+static void clear_receive_state(struct terminal *terminal) {
+  terminal->receive_state = RECEIVE_GROUND;
   terminal->prev_codepoint = 0;
   clear_esc_params(terminal);
 
@@ -54,15 +72,12 @@ static void clear_receive_table(struct terminal *terminal) {
 #endif
 }
 
-static const receive_table_t esc_receive_table;
-static const receive_table_t vt52_esc_receive_table;
-
 static void cancel_esc(struct terminal *terminal) {
-  if (!codepoint_receive_table(terminal)) {
+  if (!codepoint_receive_state(terminal)) {
 #ifdef DEBUG
     terminal->unhandled = true;
 #endif
-    clear_receive_table(terminal);
+    clear_receive_state(terminal);
   }
 }
 
@@ -70,9 +85,9 @@ static void receive_esc(struct terminal *terminal, character_t character) {
   cancel_esc(terminal);
 
   if (terminal->ansi_mode)
-    terminal->receive_table = &esc_receive_table;
+    terminal->receive_state = RECEIVE_ESC;
   else
-    terminal->receive_table = &vt52_esc_receive_table;
+    terminal->receive_state = RECEIVE_VT52_ESC;
 
 #ifdef DEBUG
   memset(terminal->debug_buffer, 0, DEBUG_BUFFER_LENGTH);
@@ -131,7 +146,7 @@ static void receive_cht(struct terminal *terminal, character_t character) {
 
   terminal_screen_move_cursor_absolute(
       terminal, get_terminal_screen_cursor_row(terminal), col);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_cbt(struct terminal *terminal, character_t character) {
@@ -148,7 +163,7 @@ static void receive_cbt(struct terminal *terminal, character_t character) {
 
   terminal_screen_move_cursor_absolute(
       terminal, get_terminal_screen_cursor_row(terminal), col);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_bell(struct terminal *terminal, character_t character) {
@@ -159,151 +174,53 @@ static void receive_bs(struct terminal *terminal, character_t character) {
   terminal_screen_move_cursor(terminal, 0, -1);
 }
 
-static void receive_si(struct terminal *terminal, character_t character) {
-  terminal->vs.gset_gl = GSET_G0;
-}
-
-static void receive_so(struct terminal *terminal, character_t character) {
-  terminal->vs.gset_gl = GSET_G1;
-}
-
 static void receive_nel(struct terminal *terminal, character_t character) {
   terminal_screen_carriage_return(terminal);
   terminal_screen_index(terminal, 1);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_ind(struct terminal *terminal, character_t character) {
   terminal_screen_index(terminal, 1);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_hts(struct terminal *terminal, character_t character) {
   set_tab_stop(terminal, get_terminal_screen_cursor_col(terminal), true);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_ri(struct terminal *terminal, character_t character) {
   terminal_screen_reverse_index(terminal, 1);
-  clear_receive_table(terminal);
-}
-
-static void receive_ss2(struct terminal *terminal, character_t character) {
-#ifdef DEBUG
-  terminal->unhandled = true;
-#endif
-  clear_receive_table(terminal);
-}
-
-static void receive_ss3(struct terminal *terminal, character_t character) {
-#ifdef DEBUG
-  terminal->unhandled = true;
-#endif
-  clear_receive_table(terminal);
-}
-
-static void receive_decsc(struct terminal *terminal, character_t character) {
-  terminal_screen_save_visual_state(terminal);
-  clear_receive_table(terminal);
-}
-
-static void receive_decrc(struct terminal *terminal, character_t character) {
-  terminal_screen_restore_visual_state(terminal);
-  clear_receive_table(terminal);
-}
-
-static void receive_ls2(struct terminal *terminal, character_t character) {
-  terminal->vs.gset_gl = GSET_G2;
-  clear_receive_table(terminal);
-}
-
-static void receive_ls3(struct terminal *terminal, character_t character) {
-  terminal->vs.gset_gl = GSET_G3;
-  clear_receive_table(terminal);
-}
-
-static const receive_table_t csi_receive_table;
-
-static void receive_csi(struct terminal *terminal, character_t character) {
-  terminal->receive_table = &csi_receive_table;
-}
-
-static const receive_table_t esc_hash_receive_table;
-
-static void receive_hash(struct terminal *terminal, character_t character) {
-  terminal->receive_table = &esc_hash_receive_table;
-}
-
-static const receive_table_t esc_space_receive_table;
-
-static void receive_space(struct terminal *terminal, character_t character) {
-  terminal->receive_table = &esc_space_receive_table;
-}
-
-static const receive_table_t esc_percent_receive_table;
-
-static void receive_percent(struct terminal *terminal, character_t character) {
-  terminal->receive_table = &esc_percent_receive_table;
+  clear_receive_state(terminal);
 }
 
 static void receive_s7c1t(struct terminal *terminal, character_t character) {
   terminal->transmit_c1_mode = C1_MODE_7BIT;
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_s8c1t(struct terminal *terminal, character_t character) {
   terminal->transmit_c1_mode = C1_MODE_8BIT;
-  clear_receive_table(terminal);
-}
-
-static void receive_charset_iso_8859_1(struct terminal *terminal,
-                                       character_t character) {
-  terminal->charset = CHARSET_ISO_8859_1;
-  clear_receive_table(terminal);
-}
-
-static void receive_charset_utf8(struct terminal *terminal,
-                                 character_t character) {
-  terminal->charset = CHARSET_UTF8;
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_deckpam(struct terminal *terminal, character_t character) {
   terminal->lock_state.num = 0;
   terminal_keyboard_update_leds(terminal);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_deckpnm(struct terminal *terminal, character_t character) {
   terminal->lock_state.num = 1;
   terminal_keyboard_update_leds(terminal);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_ris(struct terminal *terminal, character_t character) {
   terminal->callbacks->reset();
 }
 
-static const receive_table_t scs_receive_table;
-
-static const uint8_t scs_gset_decode_table[CHARACTER_DECODER_TABLE_LENGTH] = {
-    ['('] = GSET_G0,
-    [')'] = GSET_G1,
-    ['*'] = GSET_G2,
-    ['+'] = GSET_G3,
-};
-
-static const codepoint_transformation_table_t dec_special_graphics_table = {
-    [0x5f] = 0x00a0, [0x60] = 0x25c6, [0x61] = 0x2592, [0x62] = 0x2409,
-    [0x63] = 0x240c, [0x64] = 0x240d, [0x65] = 0x240a, [0x66] = 0x00b0,
-    [0x67] = 0x00b1, [0x68] = 0x2424, [0x69] = 0x240b, [0x6a] = 0x2518,
-    [0x6b] = 0x2510, [0x6c] = 0x250c, [0x6d] = 0x2514, [0x6e] = 0x253c,
-    [0x6f] = 0x23ba, [0x70] = 0x23bb, [0x71] = 0x2500, [0x72] = 0x23bc,
-    [0x73] = 0x23bd, [0x74] = 0x251c, [0x75] = 0x2524, [0x76] = 0x2534,
-    [0x77] = 0x252c, [0x78] = 0x2502, [0x79] = 0x2264, [0x7a] = 0x2265,
-    [0x7b] = 0x03c0, [0x7c] = 0x2260, [0x7d] = 0x00a3, [0x7e] = 0x00b7,
-};
-
 static const codepoint_transformation_table_t ibm_pc_table = {
     [0x01] = 0x263a, [0x02] = 0x263b, [0x03] = 0x2665, [0x04] = 0x2666,
     [0x05] = 0x2663, [0x06] = 0x2660, [0x07] = 0x2022, [0x08] = 0x25d8,
@@ -347,54 +264,341 @@ static const codepoint_transformation_table_t ibm_pc_table = {
     [0xfc] = 0x207f, [0xfd] = 0x00b2, [0xfe] = 0x25a0, [0xff] = 0x00a0,
 };
 
-static const codepoint_transformation_table_t
-    *scs_charset_table[CHARACTER_DECODER_TABLE_LENGTH] = {
-        ['0'] = &dec_special_graphics_table};
+static const uint8_t scs_gset_decode_table[CHARACTER_DECODER_TABLE_LENGTH] = {
+    ['('] = GSET_G0, [')'] = GSET_G1, ['*'] = GSET_G2, ['+'] = GSET_G3,
+    ['-'] = GSET_G1, ['.'] = GSET_G2, ['/'] = GSET_G3,
+};
+
+struct gset_replacement {
+  character_t character;
+  codepoint_t codepoint;
+};
 
-static void receive_scs(struct terminal *terminal, character_t character) {
-  terminal->gset_received = scs_gset_decode_table[character];
-  terminal->receive_table = &scs_receive_table;
+// Characters 0x20-0x7f of a designated set are the base, ASCII or the
+// Latin-1 upper half, with some of them replaced
+struct gset_charset {
+  codepoint_t base;
+  const struct gset_replacement *replacements;
+  size_t replacements_count;
+};
+
+#define GSET_CHARSET(name, base)                                               \
+  static const struct gset_charset name##_charset = {                          \
+      base, name##_replacements,                                               \
+      sizeof(name##_replacements) / sizeof(struct gset_replacement)}
+
+static const struct gset_charset ascii_charset = {0x00, NULL, 0};
+
+static const struct gset_charset latin_1_charset = {0x80, NULL, 0};
+
+static const struct gset_replacement dec_special_graphics_replacements[] = {
+    {0x5f, 0x00a0}, {0x60, 0x25c6}, {0x61, 0x2592}, {0x62, 0x2409},
+    {0x63, 0x240c}, {0x64, 0x240d}, {0x65, 0x240a}, {0x66, 0x00b0},
+    {0x67, 0x00b1}, {0x68, 0x2424}, {0x69, 0x240b}, {0x6a, 0x2518},
+    {0x6b, 0x2510}, {0x6c, 0x250c}, {0x6d, 0x2514}, {0x6e, 0x253c},
+    {0x6f, 0x23ba}, {0x70, 0x23bb}, {0x71, 0x2500}, {0x72, 0x23bc},
+    {0x73, 0x23bd}, {0x74, 0x251c}, {0x75, 0x2524}, {0x76, 0x2534},
+    {0x77, 0x252c}, {0x78, 0x2502}, {0x79, 0x2264}, {0x7a, 0x2265},
+    {0x7b, 0x03c0}, {0x7c, 0x2260}, {0x7d, 0x00a3}, {0x7e, 0x00b7},
+};
+GSET_CHARSET(dec_special_graphics, 0x00);
+
+static const struct gset_replacement dec_supplemental_replacements[] = {
+    {0x28, 0x00a4}, {0x57, 0x0152}, {0x5d, 0x0178},
+    {0x77, 0x0153}, {0x7d, 0x00ff},
+};
+GSET_CHARSET(dec_supplemental, 0x80);
+
+// National replacement character sets
+static const struct gset_replacement uk_replacements[] = {
+    {0x23, 0x00a3},
+};
+GSET_CHARSET(uk, 0x00);
+
+static const struct gset_replacement dutch_replacements[] = {
+    {0x23, 0x00a3}, {0x40, 0x00be}, {0x5b, 0x0133}, {0x5c, 0x00bd},
+    {0x5d, 0x007c}, {0x7b, 0x00a8}, {0x7c, 0x0192}, {0x7d, 0x00bc},
+    {0x7e, 0x00b4},
+};
+GSET_CHARSET(dutch, 0x00);
+
+static const struct gset_replacement finnish_replacements[] = {
+    {0x5b, 0x00c4}, {0x5c, 0x00d6}, {0x5d, 0x00c5}, {0x5e, 0x00dc},
+    {0x60, 0x00e9}, {0x7b, 0x00e4}, {0x7c, 0x00f6}, {0x7d, 0x00e5},
+    {0x7e, 0x00fc},
+};
+GSET_CHARSET(finnish, 0x00);
+
+static const struct gset_replacement french_replacements[] = {
+    {0x23, 0x00a3}, {0x40, 0x00e0}, {0x5b, 0x00b0}, {0x5c, 0x00e7},
+    {0x5d, 0x00a7}, {0x7b, 0x00e9}, {0x7c, 0x00f9}, {0x7d, 0x00e8},
+    {0x7e, 0x00a8},
+};
+GSET_CHARSET(french, 0x00);
+
+static const struct gset_replacement french_canadian_replacements[] = {
+    {0x40, 0x00e0}, {0x5b, 0x00e2}, {0x5c, 0x00e7}, {0x5d, 0x00ea},
+    {0x5e, 0x00ee}, {0x60, 0x00f4}, {0x7b, 0x00e9}, {0x7c, 0x00f9},
+    {0x7d, 0x00e8}, {0x7e, 0x00fb},
+};
+GSET_CHARSET(french_canadian, 0x00);
+
+static const struct gset_replacement german_replacements[] = {
+    {0x40, 0x00a7}, {0x5b, 0x00c4}, {0x5c, 0x00d6}, {0x5d, 0x00dc},
+    {0x7b, 0x00e4}, {0x7c, 0x00f6}, {0x7d, 0x00fc}, {0x7e, 0x00df},
+};
+GSET_CHARSET(german, 0x00);
+
+static const struct gset_replacement italian_replacements[] = {
+    {0x23, 0x00a3}, {0x40, 0x00a7}, {0x5b, 0x00b0}, {0x5c, 0x00e7},
+    {0x5d, 0x00e9}, {0x60, 0x00f9}, {0x7b, 0x00e0}, {0x7c, 0x00f2},
+    {0x7d, 0x00e8}, {0x7e, 0x00ec},
+};
+GSET_CHARSET(italian, 0x00);
+
+static const struct gset_replacement norwegian_danish_replacements[] = {
+    {0x40, 0x00c4}, {0x5b, 0x00c6}, {0x5c, 0x00d8}, {0x5d, 0x00c5},
+    {0x5e, 0x00dc}, {0x60, 0x00e4}, {0x7b, 0x00e6}, {0x7c, 0x00f8},
+    {0x7d, 0x00e5}, {0x7e, 0x00fc},
+};
+GSET_CHARSET(norwegian_danish, 0x00);
+
+static const struct gset_replacement spanish_replacements[] = {
+    {0x23, 0x00a3}, {0x40, 0x00a7}, {0x5b, 0x00a1}, {0x5c, 0x00d1},
+    {0x5d, 0x00bf}, {0x7b, 0x00b0}, {0x7c, 0x00f1}, {0x7d, 0x00e7},
+};
+GSET_CHARSET(spanish, 0x00);
+
+static const struct gset_replacement swedish_replacements[] = {
+    {0x40, 0x00c9}, {0x5b, 0x00c4}, {0x5c, 0x00d6}, {0x5d, 0x00c5},
+    {0x5e, 0x00dc}, {0x60, 0x00e9}, {0x7b, 0x00e4}, {0x7c, 0x00f6},
+    {0x7d, 0x00e5}, {0x7e, 0x00fc},
+};
+GSET_CHARSET(swedish, 0x00);
+
+static const struct gset_replacement swiss_replacements[] = {
+    {0x23, 0x00f9}, {0x40, 0x00e0}, {0x5b, 0x00e9}, {0x5c, 0x00e7},
+    {0x5d, 0x00ea}, {0x5e, 0x00ee}, {0x5f, 0x00e8}, {0x60, 0x00f4},
+    {0x7b, 0x00e4}, {0x7c, 0x00f6}, {0x7d, 0x00fc}, {0x7e, 0x00fb},
+};
+GSET_CHARSET(swiss, 0x00);
+
+static const struct gset_charset
+    *scs_94_charset_table[CHARACTER_DECODER_TABLE_LENGTH] = {
+        ['B'] = &ascii_charset,
+        ['1'] = &ascii_charset,
+        ['0'] = &dec_special_graphics_charset,
+        ['2'] = &dec_special_graphics_charset,
+        ['<'] = &dec_supplemental_charset,
+        ['A'] = &uk_charset,
+        ['4'] = &dutch_charset,
+        ['C'] = &finnish_charset,
+        ['5'] = &finnish_charset,
+        ['R'] = &french_charset,
+        ['f'] = &french_charset,
+        ['Q'] = &french_canadian_charset,
+        ['9'] = &french_canadian_charset,
+        ['K'] = &german_charset,
+        ['Y'] = &italian_charset,
+        ['E'] = &norwegian_danish_charset,
+        ['6'] = &norwegian_danish_charset,
+        ['`'] = &norwegian_danish_charset,
+        ['Z'] = &spanish_charset,
+        ['H'] = &swedish_charset,
+        ['7'] = &swedish_charset,
+        ['='] = &swiss_charset,
+};
+
+static const struct gset_charset
+    *scs_96_charset_table[CHARACTER_DECODER_TABLE_LENGTH] = {
+        ['A'] = &latin_1_charset,
+};
+
+static const struct gset_charset *get_gset_charset(struct terminal *terminal,
+                                                   enum gset gset) {
+  if (gset != GSET_UNDEFINED && gset <= GSET_MAX &&
+      terminal->vs.gset_charset[gset - 1])
+    return terminal->vs.gset_charset[gset - 1];
+
+  return &ascii_charset;
+}
+
+static codepoint_t get_gset_codepoint(const struct gset_charset *charset,
+                                      character_t character) {
+  for (size_t i = 0; i < charset->replacements_count; ++i)
+    if (charset->replacements[i].character == character)
+      return charset->replacements[i].codepoint;
+
+  return character | charset->base;
+}
+
+// Sets map entries of characters 0x20-0x7f
+static void map_gset_charset(codepoint_t *map,
+                             const struct gset_charset *charset) {
+  for (size_t character = 0x20; character < 0x80; ++character)
+    map[character] = character | charset->base;
+
+  for (size_t i = 0; i < charset->replacements_count; ++i)
+    map[charset->replacements[i].character] =
+        charset->replacements[i].codepoint;
+}
+
+// Received characters are looked up in one map built from the charset,
+// the sets invoked into GL and GR and their designations when they change
+static void update_charset_map(struct terminal *terminal) {
+  codepoint_t *map = terminal->charset_map;
+
+  for (size_t character = 0; character < CHARACTER_DECODER_TABLE_LENGTH;
+       ++character)
+    map[character] = character;
+
+  map_gset_charset(map, get_gset_charset(terminal, terminal->vs.gset_gl));
+
+  // Bytes 0xa0-0xff are Latin-1 until a set is invoked into GR
+  if (terminal->charset == CHARSET_ISO_8859_1 &&
+      terminal->vs.gset_gr != GSET_UNDEFINED)
+    map_gset_charset(map + 0x80,
+                     get_gset_charset(terminal, terminal->vs.gset_gr));
+
+  if (terminal->charset == CHARSET_IBM_PC)
+    for (size_t character = 0; character < CHARACTER_DECODER_TABLE_LENGTH;
+         ++character)
+      if (map[character] == character && ibm_pc_table[character])
+        map[character] = ibm_pc_table[character];
 }
 
-static void receive_scs_set(struct terminal *terminal, character_t character) {
-  if (terminal->gset_received != GSET_UNDEFINED &&
-      terminal->gset_received <= GSET_MAX) {
-    terminal->vs.gset_table[terminal->gset_received - 1] =
-        scs_charset_table[character];
+static void receive_scs(struct terminal *terminal, character_t character) {
+  enum gset gset = scs_gset_decode_table[terminal->esc_intermediate];
+  const struct gset_charset *charset =
+      terminal->esc_intermediate >= '-' ? scs_96_charset_table[character]
+                                        : scs_94_charset_table[character];
+
+  if (gset != GSET_UNDEFINED && gset <= GSET_MAX && charset) {
+    terminal->vs.gset_charset[gset - 1] = charset;
+    update_charset_map(terminal);
   }
+#ifdef DEBUG
+  else
+    terminal->unhandled = true;
+#endif
 
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
+}
+
+static void invoke_gset(struct terminal *terminal, enum gset gl,
+                        enum gset gr) {
+  if (gl != GSET_UNDEFINED)
+    terminal->vs.gset_gl = gl;
+
+  if (gr != GSET_UNDEFINED)
+    terminal->vs.gset_gr = gr;
+
+  update_charset_map(terminal);
+}
+
+static void receive_si(struct terminal *terminal, character_t character) {
+  invoke_gset(terminal, GSET_G0, GSET_UNDEFINED);
+}
+
+static void receive_so(struct terminal *terminal, character_t character) {
+  invoke_gset(terminal, GSET_G1, GSET_UNDEFINED);
+}
+
+static void receive_ls2(struct terminal *terminal, character_t character) {
+  invoke_gset(terminal, GSET_G2, GSET_UNDEFINED);
+  clear_receive_state(terminal);
+}
+
+static void receive_ls3(struct terminal *terminal, character_t character) {
+  invoke_gset(terminal, GSET_G3, GSET_UNDEFINED);
+  clear_receive_state(terminal);
+}
+
+static void receive_ls1r(struct terminal *terminal, character_t character) {
+  invoke_gset(terminal, GSET_UNDEFINED, GSET_G1);
+  clear_receive_state(terminal);
+}
+
+static void receive_ls2r(struct terminal *terminal, character_t character) {
+  invoke_gset(terminal, GSET_UNDEFINED, GSET_G2);
+  clear_receive_state(terminal);
+}
+
+static void receive_ls3r(struct terminal *terminal, character_t character) {
+  invoke_gset(terminal, GSET_UNDEFINED, GSET_G3);
+  clear_receive_state(terminal);
+}
+
+// Single shifts take the next printable character from G2 or G3
+static void receive_ss2(struct terminal *terminal, character_t character) {
+  terminal->single_shift = GSET_G2;
+  clear_receive_state(terminal);
+}
+
+static void receive_ss3(struct terminal *terminal, character_t character) {
+  terminal->single_shift = GSET_G3;
+  clear_receive_state(terminal);
+}
+
+static void receive_decsc(struct terminal *terminal, character_t character) {
+  terminal_screen_save_visual_state(terminal);
+  clear_receive_state(terminal);
+}
+
+static void receive_decrc(struct terminal *terminal, character_t character) {
+  terminal_screen_restore_visual_state(terminal);
+  update_charset_map(terminal);
+  clear_receive_state(terminal);
+}
+
+static void receive_charset_iso_8859_1(struct terminal *terminal,
+                                       character_t character) {
+  terminal->charset = CHARSET_ISO_8859_1;
+  update_charset_map(terminal);
+  clear_receive_state(terminal);
+}
+
+static void receive_charset_utf8(struct terminal *terminal,
+                                 character_t character) {
+  terminal->charset = CHARSET_UTF8;
+  update_charset_map(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_esc_param(struct terminal *terminal,
                               character_t character) {
-  if (!terminal->esc_last_param_length) {
-    if (terminal->esc_params_count == ESC_MAX_PARAMS_COUNT)
-      return;
+  if (!terminal->esc_params_count)
+    terminal->esc_params_count = 1;
 
-    terminal->esc_params_count++;
-  }
+  size_t index = terminal->esc_params_count - 1;
+  uint16_t digit = character - '0';
 
-  // Keep zero for the end of the string for atoi
-  if (terminal->esc_last_param_length == ESC_MAX_PARAM_LENGTH - 1)
+  if (index >= ESC_MAX_PARAMS_COUNT)
     return;
 
-  terminal->esc_last_param_length++;
-  terminal->esc_params[terminal->esc_params_count - 1]
-                      [terminal->esc_last_param_length - 1] = character;
+  if (!is_esc_param_given(terminal, index)) {
+    terminal->esc_params[index] = digit;
+    terminal->esc_params_given |= 1 << index;
+  } else if (terminal->esc_params[index] <=
+             (ESC_MAX_PARAM_VALUE - digit) / 10)
+    terminal->esc_params[index] = terminal->esc_params[index] * 10 + digit;
+  else
+    terminal->esc_params[index] = ESC_MAX_PARAM_VALUE;
 }
 
 static void receive_esc_param_delimiter(struct terminal *terminal,
                                         character_t character) {
-  if (!terminal->esc_last_param_length) {
-    if (terminal->esc_params_count == ESC_MAX_PARAMS_COUNT)
-      return;
+  if (!terminal->esc_params_count)
+    terminal->esc_params_count = 1;
 
-    terminal->esc_params_count++;
+  // Parameters past the last one kept are counted once and dropped
+  if (terminal->esc_params_count > ESC_MAX_PARAMS_COUNT)
     return;
-  }
 
-  terminal->esc_last_param_length = 0;
+  if (character == ':' && terminal->esc_params_count < ESC_MAX_PARAMS_COUNT)
+    terminal->esc_params_sub |= 1 << terminal->esc_params_count;
+
+  terminal->esc_params_count++;
 }
 
 static void receive_rep(struct terminal *terminal, character_t character) {
@@ -407,12 +611,12 @@ static void receive_rep(struct terminal *terminal, character_t character) {
     while (n--)
       terminal_screen_put_codepoint(terminal, terminal->prev_codepoint);
 
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_da(struct terminal *terminal, character_t character) {
   terminal_uart_transmit_string(terminal, "\x1b[?65;1;9c");
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_sec_da(struct terminal *terminal, character_t character) {
@@ -421,7 +625,7 @@ static void receive_sec_da(struct terminal *terminal, character_t character) {
   if (mode == 0)
     terminal_uart_transmit_string(terminal, "\x1b[>65;6003;1c");
 
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_hvp(struct terminal *terminal, character_t character) {
@@ -429,7 +633,7 @@ static void receive_hvp(struct terminal *terminal, character_t character) {
   int16_t col = get_esc_param(terminal, 1);
 
   terminal_screen_move_cursor_absolute(terminal, row - 1, col - 1);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_tbc(struct terminal *terminal, character_t character) {
@@ -444,7 +648,7 @@ static void receive_tbc(struct terminal *terminal, character_t character) {
     terminal->unhandled = true;
 #endif
 
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_hpa(struct terminal *terminal, character_t character) {
@@ -454,7 +658,7 @@ static void receive_hpa(struct terminal *terminal, character_t character) {
 
   terminal_screen_move_cursor_absolute(
       terminal, get_terminal_screen_cursor_row(terminal), col - 1);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_hpr(struct terminal *terminal, character_t character) {
@@ -466,7 +670,7 @@ static void receive_hpr(struct terminal *terminal, character_t character) {
   terminal_screen_wrap_last_col(terminal);
 
   terminal_screen_move_cursor(terminal, 0, cols);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_vpa(struct terminal *terminal, character_t character) {
@@ -476,7 +680,7 @@ static void receive_vpa(struct terminal *terminal, character_t character) {
 
   terminal_screen_move_cursor_absolute(
       terminal, row - 1, get_terminal_screen_cursor_col(terminal));
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_vpr(struct terminal *terminal, character_t character) {
@@ -488,7 +692,7 @@ static void receive_vpr(struct terminal *terminal, character_t character) {
   terminal_screen_wrap_last_col(terminal);
 
   terminal_screen_move_cursor(terminal, rows, 0);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_sm(struct terminal *terminal, character_t character) {
@@ -517,7 +721,7 @@ static void receive_sm(struct terminal *terminal, character_t character) {
     break;
 #endif
   }
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_rm(struct terminal *terminal, character_t character) {
@@ -546,7 +750,7 @@ static void receive_rm(struct terminal *terminal, character_t character) {
     break;
 #endif
   }
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_dsr(struct terminal *terminal, character_t character) {
@@ -570,11 +774,40 @@ static void receive_dsr(struct terminal *terminal, character_t character) {
 #endif
   }
 
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
+}
+
+static void receive_decdsr(struct terminal *terminal, character_t character) {
+  uint16_t code = get_esc_param(terminal, 0);
+
+  switch (code) {
+  case DSR_LINK_STATISTICS: {
+    const struct link_statistics *link_statistics =
+        &terminal->link_statistics;
+
+    terminal_uart_transmit_printf(
+        terminal,
+        "\x1b[?%d;%" PRIu32 ";%" PRIu32 ";%" PRIu32 ";%" PRIu32 ";%" PRIu32
+        ";%" PRIu32 ";%" PRIu32 ";%" PRIu32 "n",
+        DSR_LINK_STATISTICS, link_statistics->ring_overruns,
+        link_statistics->ring_lost, link_statistics->overrun_errors,
+        link_statistics->framing_errors, link_statistics->parity_errors,
+        link_statistics->noise_errors, link_statistics->peak_fill,
+        link_statistics->xoff_time);
+  } break;
+
+#ifdef DEBUG
+  default:
+    terminal->unhandled = true;
+    break;
+#endif
+  }
+
+  clear_receive_state(terminal);
 }
 
 static void receive_dectst(struct terminal *terminal, character_t character) {
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_cup(struct terminal *terminal, character_t character) {
@@ -582,27 +815,73 @@ static void receive_cup(struct terminal *terminal, character_t character) {
   int16_t col = get_esc_param(terminal, 1);
 
   terminal_screen_move_cursor_absolute(terminal, row - 1, col - 1);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
+}
+
+static size_t get_sgr_color_level(struct terminal *terminal, size_t *i) {
+  int16_t value = get_esc_param(terminal, (*i)++);
+
+  if (value < 0)
+    value = 0;
+  else if (value > 0xff)
+    value = 0xff;
+
+  return value >> (8 - COLOR_TABLE_BITS);
+}
+
+static size_t get_esc_sub_params_count(struct terminal *terminal,
+                                       size_t index) {
+  size_t count = 0;
+
+  while (is_esc_sub_param(terminal, index + count))
+    count++;
+
+  return count;
 }
 
 static color_t get_sgr_color(struct terminal *terminal, size_t *i) {
+  bool sub = is_esc_sub_param(terminal, *i);
   uint16_t code = get_esc_param(terminal, (*i)++);
 
   if (code == 5) {
     return get_esc_param(terminal, (*i)++);
   } else if (code == 2) {
-    get_esc_param(terminal, (*i)++);
-    get_esc_param(terminal, (*i)++);
-    get_esc_param(terminal, (*i)++);
+    // 38:2:id:r:g:b has a color space id, 38:2:r:g:b and 38;2;r;g;b do not
+    if (sub && get_esc_sub_params_count(terminal, *i) > 3)
+      (*i)++;
 
-    // TODO: get the closest color from CLUT
-#ifdef DEBUG
-    terminal->unhandled = true;
-#endif
+    size_t red = get_sgr_color_level(terminal, i);
+    size_t green = get_sgr_color_level(terminal, i);
+    size_t blue = get_sgr_color_level(terminal, i);
+
+    return color_table[(((red << COLOR_TABLE_BITS) | green)
+                        << COLOR_TABLE_BITS) |
+                       blue];
   }
   return DEFAULT_ACTIVE_COLOR;
 }
 
+#ifdef TERMINAL_8BIT_COLOR
+// Entries of the 256 color cube with the default colors' RGB
+#define CUBE_ACTIVE_COLOR 231
+#define CUBE_INACTIVE_COLOR 16
+#endif
+
+// Screen mode swaps the entries of the default colors, so explicit colors on
+// them are kept on cube entries of the same color, which do not swap
+static color_t get_explicit_color(struct terminal *terminal, color_t color) {
+#ifdef TERMINAL_8BIT_COLOR
+  if (color == DEFAULT_ACTIVE_COLOR &&
+      terminal->palette[CUBE_ACTIVE_COLOR] == terminal->palette[color])
+    return CUBE_ACTIVE_COLOR;
+  else if (color == DEFAULT_INACTIVE_COLOR &&
+           terminal->palette[CUBE_INACTIVE_COLOR] == terminal->palette[color])
+    return CUBE_INACTIVE_COLOR;
+#endif
+
+  return color;
+}
+
 static void handle_sgr(struct terminal *terminal, size_t *i) {
   uint16_t code = get_esc_param(terminal, (*i)++);
   bool unhandled = false;
@@ -633,7 +912,11 @@ static void handle_sgr(struct terminal *terminal, size_t *i) {
     break;
 
   case 4:
-    terminal->vs.p.underlined = true;
+    // Underline styles 4:1 to 4:5 are all drawn as a single underline
+    if (is_esc_sub_param(terminal, *i))
+      terminal->vs.p.underlined = get_esc_param(terminal, (*i)++) != 0;
+    else
+      terminal->vs.p.underlined = true;
     break;
 
   case 5:
@@ -684,7 +967,8 @@ static void handle_sgr(struct terminal *terminal, size_t *i) {
     break;
 
   case 38:
-    terminal->vs.p.active_color = get_sgr_color(terminal, i);
+    terminal->vs.p.active_color =
+        get_explicit_color(terminal, get_sgr_color(terminal, i));
     break;
 
   case 39:
@@ -692,13 +976,22 @@ static void handle_sgr(struct terminal *terminal, size_t *i) {
     break;
 
   case 48:
-    terminal->vs.p.inactive_color = get_sgr_color(terminal, i);
+    terminal->vs.p.inactive_color =
+        get_explicit_color(terminal, get_sgr_color(terminal, i));
     break;
 
   case 49:
     terminal->vs.p.inactive_color = DEFAULT_INACTIVE_COLOR;
     break;
 
+  case 58:
+    // Underline color is not drawn, skip its parameters
+    get_sgr_color(terminal, i);
+    break;
+
+  case 59:
+    break;
+
   default:
     unhandled = true;
     break;
@@ -706,29 +999,37 @@ static void handle_sgr(struct terminal *terminal, size_t *i) {
 
   if (unhandled) {
     if (code >= 30 && code < 38)
-      terminal->vs.p.active_color = code - 30;
+      terminal->vs.p.active_color = get_explicit_color(terminal, code - 30);
     else if (code >= 40 && code < 48)
-      terminal->vs.p.inactive_color = code - 40;
+      terminal->vs.p.inactive_color = get_explicit_color(terminal, code - 40);
     else if (code >= 90 && code < 98)
-      terminal->vs.p.active_color = code - 90 + 8;
+      terminal->vs.p.active_color =
+          get_explicit_color(terminal, code - 90 + 8);
     else if (code >= 100 && code < 108)
-      terminal->vs.p.inactive_color = code - 100 + 8;
+      terminal->vs.p.inactive_color =
+          get_explicit_color(terminal, code - 100 + 8);
 #ifdef DEBUG
     else
       terminal->unhandled = true;
 #endif
   }
+
+  // Sub-parameters an attribute does not use are skipped with it
+  while (is_esc_sub_param(terminal, *i))
+    (*i)++;
 }
 
 static void receive_sgr(struct terminal *terminal, character_t character) {
+  size_t count = get_esc_params_count(terminal);
   size_t i = 0;
-  if (terminal->esc_params_count) {
-    while (i < terminal->esc_params_count)
+
+  if (count) {
+    while (i < count)
       handle_sgr(terminal, &i);
   } else
     handle_sgr(terminal, &i);
 
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_cuu(struct terminal *terminal, character_t character) {
@@ -737,7 +1038,7 @@ static void receive_cuu(struct terminal *terminal, character_t character) {
     rows = 1;
 
   terminal_screen_move_cursor(terminal, -rows, 0);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_cud(struct terminal *terminal, character_t character) {
@@ -746,7 +1047,7 @@ static void receive_cud(struct terminal *terminal, character_t character) {
     rows = 1;
 
   terminal_screen_move_cursor(terminal, rows, 0);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_cuf(struct terminal *terminal, character_t character) {
@@ -755,7 +1056,7 @@ static void receive_cuf(struct terminal *terminal, character_t character) {
     cols = 1;
 
   terminal_screen_move_cursor(terminal, 0, cols);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_cub(struct terminal *terminal, character_t character) {
@@ -764,7 +1065,7 @@ static void receive_cub(struct terminal *terminal, character_t character) {
     cols = 1;
 
   terminal_screen_move_cursor(terminal, 0, -cols);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_cnl(struct terminal *terminal, character_t character) {
@@ -774,7 +1075,7 @@ static void receive_cnl(struct terminal *terminal, character_t character) {
 
   terminal_screen_carriage_return(terminal);
   terminal_screen_index(terminal, rows);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_cpl(struct terminal *terminal, character_t character) {
@@ -784,7 +1085,7 @@ static void receive_cpl(struct terminal *terminal, character_t character) {
 
   terminal_screen_carriage_return(terminal);
   terminal_screen_reverse_index(terminal, rows);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_cha(struct terminal *terminal, character_t character) {
@@ -794,7 +1095,7 @@ static void receive_cha(struct terminal *terminal, character_t character) {
 
   terminal_screen_move_cursor_absolute(
       terminal, get_terminal_screen_cursor_row(terminal), col - 1);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_sd(struct terminal *terminal, character_t character) {
@@ -803,7 +1104,7 @@ static void receive_sd(struct terminal *terminal, character_t character) {
     rows = 1;
 
   terminal_screen_scroll(terminal, SCROLL_DOWN, terminal->margin_top, rows);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_su(struct terminal *terminal, character_t character) {
@@ -812,7 +1113,7 @@ static void receive_su(struct terminal *terminal, character_t character) {
     rows = 1;
 
   terminal_screen_scroll(terminal, SCROLL_UP, terminal->margin_top, rows);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_ed(struct terminal *terminal, character_t character) {
@@ -846,7 +1147,7 @@ static void receive_ed(struct terminal *terminal, character_t character) {
 #endif
   }
 
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_el(struct terminal *terminal, character_t character) {
@@ -875,7 +1176,7 @@ static void receive_el(struct terminal *terminal, character_t character) {
 #endif
   }
 
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_ich(struct terminal *terminal, character_t character) {
@@ -886,7 +1187,7 @@ static void receive_ich(struct terminal *terminal, character_t character) {
   terminal_screen_cancel_wrap_last_col(terminal);
 
   terminal_screen_insert(terminal, cols);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_dch(struct terminal *terminal, character_t character) {
@@ -897,7 +1198,7 @@ static void receive_dch(struct terminal *terminal, character_t character) {
   terminal_screen_cancel_wrap_last_col(terminal);
 
   terminal_screen_delete(terminal, cols);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_ech(struct terminal *terminal, character_t character) {
@@ -908,7 +1209,7 @@ static void receive_ech(struct terminal *terminal, character_t character) {
   terminal_screen_cancel_wrap_last_col(terminal);
 
   terminal_screen_erase(terminal, cols);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_il(struct terminal *terminal, character_t character) {
@@ -918,7 +1219,7 @@ static void receive_il(struct terminal *terminal, character_t character) {
 
   terminal_screen_scroll(terminal, SCROLL_DOWN,
                          get_terminal_screen_cursor_row(terminal), rows);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_dl(struct terminal *terminal, character_t character) {
@@ -928,7 +1229,7 @@ static void receive_dl(struct terminal *terminal, character_t character) {
 
   terminal_screen_scroll(terminal, SCROLL_UP,
                          get_terminal_screen_cursor_row(terminal), rows);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_decstbm(struct terminal *terminal, character_t character) {
@@ -947,7 +1248,7 @@ static void receive_decstbm(struct terminal *terminal, character_t character) {
     terminal_screen_move_cursor_absolute(terminal, 0, 0);
   }
 
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_decreqtparm(struct terminal *terminal,
@@ -965,7 +1266,7 @@ static void receive_decreqtparm(struct terminal *terminal,
                                   req == 0 ? 2 : 3, par, nbits, xspeed, rspeed,
                                   clkmul);
 
-    clear_receive_table(terminal);
+    clear_receive_state(terminal);
   }
 }
 
@@ -977,31 +1278,13 @@ static void receive_decaln(struct terminal *terminal, character_t character) {
     }
 
   terminal_screen_move_cursor_absolute(terminal, 0, 0);
-  clear_receive_table(terminal);
-}
-
-static const receive_table_t csi_qm_receive_table;
-
-static void receive_csi_qm(struct terminal *terminal, character_t character) {
-  terminal->receive_table = &csi_qm_receive_table;
-}
-
-static const receive_table_t csi_em_receive_table;
-
-static void receive_csi_em(struct terminal *terminal, character_t character) {
-  terminal->receive_table = &csi_em_receive_table;
+  clear_receive_state(terminal);
 }
 
 static void receive_decstr(struct terminal *terminal, character_t character) {
   terminal->callbacks->reset();
 }
 
-static const receive_table_t csi_gt_receive_table;
-
-static void receive_csi_gt(struct terminal *terminal, character_t character) {
-  terminal->receive_table = &csi_gt_receive_table;
-}
-
 static void receive_decsm(struct terminal *terminal, character_t character) {
   int16_t mode = get_esc_param(terminal, 0);
 
@@ -1068,13 +1351,17 @@ static void receive_decsm(struct terminal *terminal, character_t character) {
     terminal_screen_save_visual_state(terminal);
     break;
 
+  case 2026: // synchronized output
+    terminal_screen_set_synchronized_output_mode(terminal, true);
+    break;
+
 #ifdef DEBUG
   default:
     terminal->unhandled = true;
     break;
 #endif
   }
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_decrm(struct terminal *terminal, character_t character) {
@@ -1147,6 +1434,11 @@ static void receive_decrm(struct terminal *terminal, character_t character) {
 #endif
   case 1048:
     terminal_screen_restore_visual_state(terminal);
+    update_charset_map(terminal);
+    break;
+
+  case 2026: // synchronized output
+    terminal_screen_set_synchronized_output_mode(terminal, false);
     break;
 
 #ifdef DEBUG
@@ -1155,7 +1447,7 @@ static void receive_decrm(struct terminal *terminal, character_t character) {
     break;
 #endif
   }
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void clear_control_data(struct control_data *control_data) {
@@ -1183,168 +1475,426 @@ static bool receive_control_data(struct control_data *control_data,
   return false;
 }
 
-static const receive_table_t osc_receive_table;
-
 static void receive_osc(struct terminal *terminal, character_t character) {
-  terminal->receive_table = &osc_receive_table;
   clear_control_data(&terminal->osc);
 }
 
-static void receive_osc_data(struct terminal *terminal, character_t character) {
-  if (receive_control_data(&terminal->osc, character))
-    clear_receive_table(terminal);
-}
+static size_t
+control_data_terminator_length(struct control_data *control_data) {
+  character_t last = control_data->data[control_data->length - 1];
 
-static const receive_table_t dcs_receive_table;
+  if (last == 0x07 || last == 0x9c)
+    return 1;
 
-static void receive_dcs(struct terminal *terminal, character_t character) {
-  terminal->receive_table = &dcs_receive_table;
-  clear_control_data(&terminal->dcs);
+  if (control_data->length >= 2 &&
+      control_data->data[control_data->length - 2] == 0x1b && last == '\\')
+    return 2;
+
+  return 0;
 }
 
-static void receive_dcs_data(struct terminal *terminal, character_t character) {
-  if (receive_control_data(&terminal->dcs, character)) {
-    if (terminal->dcs.length >= DECRQSS_PREFIX_LENGTH &&
-        strncmp((char *)terminal->dcs.data, DECRQSS_PREFIX,
-                DECRQSS_PREFIX_LENGTH) == 0) {
-      terminal_uart_transmit_string(terminal, "\x1bP0$r\x1b\\");
-    }
-    clear_receive_table(terminal);
-  }
+static int hex_digit(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  else if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  else if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return -1;
 }
 
-static const receive_table_t apc_receive_table;
+// Scales 1 to 4 hex digits to a 8-bit channel
+static bool parse_color_channel(const char *digits, size_t length,
+                                rgb_t *channel) {
+  if (length < 1 || length > 4)
+    return false;
 
-static void receive_apc(struct terminal *terminal, character_t character) {
-  terminal->receive_table = &apc_receive_table;
-  clear_control_data(&terminal->apc);
-}
+  uint32_t value = 0;
 
-static void receive_apc_data(struct terminal *terminal, character_t character) {
-  if (receive_control_data(&terminal->apc, character))
-    clear_receive_table(terminal);
-}
+  for (size_t i = 0; i < length; ++i) {
+    int digit = hex_digit(digits[i]);
 
-static const receive_table_t pm_receive_table;
+    if (digit == -1)
+      return false;
 
-static void receive_pm(struct terminal *terminal, character_t character) {
-  terminal->receive_table = &pm_receive_table;
-  clear_control_data(&terminal->pm);
+    value = (value << 4) | digit;
+  }
+
+  *channel = value * 0xff / ((1 << (length * 4)) - 1);
+  return true;
+}
+
+// Parses X11 color specifications rgb:r/g/b and #rgb
+static bool parse_color_spec(const char *spec, size_t length, rgb_t *rgb) {
+  rgb_t red, green, blue;
+
+  if (length > 4 && strncmp(spec, "rgb:", 4) == 0) {
+    const char *end = spec + length;
+    const char *red_digits = spec + 4;
+    const char *red_end = memchr(red_digits, '/', end - red_digits);
+
+    if (!red_end)
+      return false;
+
+    const char *green_digits = red_end + 1;
+    const char *green_end = memchr(green_digits, '/', end - green_digits);
+
+    if (!green_end)
+      return false;
+
+    const char *blue_digits = green_end + 1;
+
+    if (!parse_color_channel(red_digits, red_end - red_digits, &red) ||
+        !parse_color_channel(green_digits, green_end - green_digits, &green) ||
+        !parse_color_channel(blue_digits, end - blue_digits, &blue))
+      return false;
+  } else if (length > 1 && spec[0] == '#' && (length - 1) % 3 == 0) {
+    size_t digits = (length - 1) / 3;
+
+    if (!parse_color_channel(spec + 1, digits, &red) ||
+        !parse_color_channel(spec + 1 + digits, digits, &green) ||
+        !parse_color_channel(spec + 1 + digits * 2, digits, &blue))
+      return false;
+  } else {
+    return false;
+  }
+
+  *rgb = (red << 16) | (green << 8) | blue;
+  return true;
+}
+
+static void set_palette_color(struct terminal *terminal, const char *index,
+                              const char *spec, size_t spec_length) {
+  int color = atoi(index);
+
+  if (color < 0 || color >= RGB_TABLE_SIZE)
+    return;
+
+  rgb_t rgb;
+
+  if (spec_length == 1 && spec[0] == '?') {
+    rgb = terminal->palette[color];
+    terminal_uart_transmit_printf(
+        terminal, "\x1b]4;%d;rgb:%04x/%04x/%04x\x1b\\", color,
+        (unsigned int)((rgb >> 16) & 0xff) * 0x101,
+        (unsigned int)((rgb >> 8) & 0xff) * 0x101,
+        (unsigned int)(rgb & 0xff) * 0x101);
+  } else if (parse_color_spec(spec, spec_length, &rgb)) {
+    terminal_screen_set_color(terminal, color, rgb);
+  }
+}
+
+// Handles complete index;spec pairs, returns the length handled
+static size_t handle_osc_set_colors(struct terminal *terminal,
+                                    const char *fields, size_t length,
+                                    bool end) {
+  const char *fields_end = fields + length;
+  const char *index = fields;
+
+  for (;;) {
+    const char *index_end = memchr(index, ';', fields_end - index);
+
+    if (!index_end)
+      break;
+
+    const char *spec = index_end + 1;
+    const char *spec_end = memchr(spec, ';', fields_end - spec);
+
+    if (!spec_end) {
+      if (!end)
+        break;
+
+      spec_end = fields_end;
+    }
+
+    set_palette_color(terminal, index, spec, spec_end - spec);
+
+    if (spec_end == fields_end)
+      return length;
+
+    index = spec_end + 1;
+  }
+
+  return index - fields;
+}
+
+// Handles complete indexes, returns the length handled
+static size_t handle_osc_reset_colors(struct terminal *terminal,
+                                      const char *fields, size_t length,
+                                      bool end) {
+  const char *fields_end = fields + length;
+  const char *index = fields;
+
+  for (;;) {
+    const char *index_end = memchr(index, ';', fields_end - index);
+
+    if (!index_end) {
+      if (!end)
+        break;
+
+      index_end = fields_end;
+    }
+
+    int color = atoi(index);
+
+    if (index_end != index && color >= 0 && color < RGB_TABLE_SIZE)
+      terminal_screen_reset_color(terminal, color);
+
+    if (index_end == fields_end)
+      return length;
+
+    index = index_end + 1;
+  }
+
+  return index - fields;
+}
+
+// Palette commands are handled field by field as they arrive, so a whole
+// color scheme fits in the control data buffer
+static void handle_osc(struct terminal *terminal, bool end) {
+  struct control_data *osc = &terminal->osc;
+  const char *data = (const char *)osc->data;
+  size_t length = osc->length;
+
+  if (end)
+    length -= control_data_terminator_length(osc);
+
+  const char *fields = memchr(data, ';', length);
+  int code = atoi(data);
+
+  if (!fields) {
+    if (end && code == 104)
+      terminal_screen_reset_palette(terminal);
+    return;
+  }
+
+  size_t prefix_length = ++fields - data;
+  size_t fields_length = length - prefix_length;
+  size_t handled;
+
+  switch (code) {
+  case 4:
+    handled = handle_osc_set_colors(terminal, fields, fields_length, end);
+    break;
+
+  case 104:
+    handled = handle_osc_reset_colors(terminal, fields, fields_length, end);
+    break;
+
+  default:
+    return;
+  }
+
+  if (!end && handled) {
+    memmove(osc->data + prefix_length, osc->data + prefix_length + handled,
+            osc->length - prefix_length - handled);
+    memset(osc->data + osc->length - handled, 0, handled);
+    osc->length -= handled;
+  }
+}
+
+static void receive_osc_data(struct terminal *terminal, character_t character) {
+  bool end = receive_control_data(&terminal->osc, character);
+
+  if (end || character == ';')
+    handle_osc(terminal, end);
+
+  if (end)
+    clear_receive_state(terminal);
+}
+
+static void receive_dcs(struct terminal *terminal, character_t character) {
+  clear_control_data(&terminal->dcs);
+}
+
+static void receive_dcs_data(struct terminal *terminal, character_t character) {
+  if (receive_control_data(&terminal->dcs, character)) {
+    if (terminal->dcs.length >= DECRQSS_PREFIX_LENGTH &&
+        strncmp((char *)terminal->dcs.data, DECRQSS_PREFIX,
+                DECRQSS_PREFIX_LENGTH) == 0) {
+      terminal_uart_transmit_string(terminal, "\x1bP0$r\x1b\\");
+    }
+    clear_receive_state(terminal);
+  }
+}
+
+static void receive_apc(struct terminal *terminal, character_t character) {
+  clear_control_data(&terminal->apc);
+}
+
+static void receive_apc_data(struct terminal *terminal, character_t character) {
+  if (receive_control_data(&terminal->apc, character))
+    clear_receive_state(terminal);
+}
+
+static void receive_pm(struct terminal *terminal, character_t character) {
+  clear_control_data(&terminal->pm);
 }
 
 static void receive_pm_data(struct terminal *terminal, character_t character) {
   if (receive_control_data(&terminal->pm, character))
-    clear_receive_table(terminal);
+    clear_receive_state(terminal);
 }
 
-static const receive_table_t vt52_move_cursor_row_receive_table;
-
 static void receive_vt52_move_cursor(struct terminal *terminal,
                                      character_t character) {
-  terminal->receive_table = &vt52_move_cursor_row_receive_table;
+  terminal->receive_state = RECEIVE_VT52_ROW;
 }
 
-static const receive_table_t vt52_move_cursor_col_receive_table;
-
 static void receive_vt52_move_cursor_row(struct terminal *terminal,
                                          character_t character) {
   terminal->vt52_move_cursor_row = character;
-  terminal->receive_table = &vt52_move_cursor_col_receive_table;
+  terminal->receive_state = RECEIVE_VT52_COL;
 }
 
 static void receive_vt52_move_cursor_col(struct terminal *terminal,
                                          character_t character) {
   terminal_screen_move_cursor_absolute(
       terminal, terminal->vt52_move_cursor_row - 32, character - 32);
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_vt52_id(struct terminal *terminal, character_t character) {
   terminal_uart_transmit_string(terminal, "\x1b/Z");
-  clear_receive_table(terminal);
+  clear_receive_state(terminal);
 }
 
 static void receive_vt52_ansi(struct terminal *terminal,
                               character_t character) {
   terminal->ansi_mode = true;
-  clear_receive_table(terminal);
-}
-
-struct utf8_codec_entry {
-  character_t mask;
-  character_t lead;
-  size_t bits_stored;
+  clear_receive_state(terminal);
+}
+
+// UTF-8 is decoded by a DFA after Bjoern Hoehrmann's, which rejects
+// overlong forms, surrogates and codepoints above U+10FFFF
+enum utf8_class {
+  UTF8_ASCII,   // 0x00-0x7f
+  UTF8_CONT_80, // 0x80-0x8f
+  UTF8_CONT_90, // 0x90-0x9f
+  UTF8_CONT_A0, // 0xa0-0xbf
+  UTF8_INVALID, // 0xc0, 0xc1 and 0xf5-0xff
+  UTF8_LEAD_2,  // 0xc2-0xdf
+  UTF8_LEAD_E0, // 0xe0
+  UTF8_LEAD_3,  // 0xe1-0xec and 0xee-0xef
+  UTF8_LEAD_ED, // 0xed
+  UTF8_LEAD_F0, // 0xf0
+  UTF8_LEAD_4,  // 0xf1-0xf3
+  UTF8_LEAD_F4, // 0xf4
+  UTF8_CLASSES,
 };
 
-static const struct utf8_codec_entry *utf8_codec[] = {
-    [0] = &(struct utf8_codec_entry){0b00111111, 0b10000000, 6},
-    [1] = &(struct utf8_codec_entry){0b01111111, 0b00000000, 7},
-    [2] = &(struct utf8_codec_entry){0b00011111, 0b11000000, 5},
-    [3] = &(struct utf8_codec_entry){0b00001111, 0b11100000, 4},
-    [4] = &(struct utf8_codec_entry){0b00000111, 0b11110000, 3},
-    &(struct utf8_codec_entry){0},
+enum utf8_state {
+  UTF8_ACCEPT,
+  UTF8_REJECT,
+  UTF8_NEED_1,  // any continuation completes the codepoint
+  UTF8_NEED_2,  // any two continuations complete the codepoint
+  UTF8_NEED_E0, // 0xa0-0xbf to exclude overlong forms
+  UTF8_NEED_ED, // 0x80-0x9f to exclude surrogates
+  UTF8_NEED_F0, // 0x90-0xbf to exclude overlong forms
+  UTF8_NEED_3,  // any three continuations complete the codepoint
+  UTF8_NEED_F4, // 0x80-0x8f to stay below U+110000
+  UTF8_STATES,
 };
 
-static size_t get_utf8_codepoint_length(character_t character) {
-  int length = 0;
-
-  for (const struct utf8_codec_entry **e = utf8_codec; *e; ++e) {
-    if ((character & ~(*e)->mask) == (*e)->lead) {
-      break;
-    }
+#define UTF8_CONT UTF8_CONT_80 ... UTF8_CONT_A0
 
-    ++length;
-  }
+static const uint8_t utf8_class_table[CHARACTER_DECODER_TABLE_LENGTH] = {
+    [0x00 ... 0x7f] = UTF8_ASCII,   [0x80 ... 0x8f] = UTF8_CONT_80,
+    [0x90 ... 0x9f] = UTF8_CONT_90, [0xa0 ... 0xbf] = UTF8_CONT_A0,
+    [0xc0 ... 0xc1] = UTF8_INVALID, [0xc2 ... 0xdf] = UTF8_LEAD_2,
+    [0xe0] = UTF8_LEAD_E0,          [0xe1 ... 0xef] = UTF8_LEAD_3,
+    [0xed] = UTF8_LEAD_ED,          [0xf0] = UTF8_LEAD_F0,
+    [0xf1 ... 0xf3] = UTF8_LEAD_4,  [0xf4] = UTF8_LEAD_F4,
+    [0xf5 ... 0xff] = UTF8_INVALID,
+};
 
-  if (length > 4)
-    return 0;
+// Codepoint bits carried by the first character of a sequence
+static const uint8_t utf8_lead_mask_table[UTF8_CLASSES] = {
+    [UTF8_ASCII] = 0x7f,
+    [UTF8_LEAD_2] = 0x1f,
+    [UTF8_LEAD_E0 ... UTF8_LEAD_ED] = 0x0f,
+    [UTF8_LEAD_F0 ... UTF8_LEAD_F4] = 0x07,
+};
 
-  return length;
-}
+static const uint8_t utf8_transition_table[UTF8_STATES][UTF8_CLASSES] = {
+    [UTF8_ACCEPT] =
+        {
+            [UTF8_ASCII] = UTF8_ACCEPT,
+            [UTF8_CONT] = UTF8_REJECT,
+            [UTF8_INVALID] = UTF8_REJECT,
+            [UTF8_LEAD_2] = UTF8_NEED_1,
+            [UTF8_LEAD_E0] = UTF8_NEED_E0,
+            [UTF8_LEAD_3] = UTF8_NEED_2,
+            [UTF8_LEAD_ED] = UTF8_NEED_ED,
+            [UTF8_LEAD_F0] = UTF8_NEED_F0,
+            [UTF8_LEAD_4] = UTF8_NEED_3,
+            [UTF8_LEAD_F4] = UTF8_NEED_F4,
+        },
+    [UTF8_REJECT] = {[0 ... UTF8_CLASSES - 1] = UTF8_REJECT},
+    [UTF8_NEED_1] = {[0 ... UTF8_CLASSES - 1] = UTF8_REJECT,
+                     [UTF8_CONT] = UTF8_ACCEPT},
+    [UTF8_NEED_2] = {[0 ... UTF8_CLASSES - 1] = UTF8_REJECT,
+                     [UTF8_CONT] = UTF8_NEED_1},
+    [UTF8_NEED_E0] = {[0 ... UTF8_CLASSES - 1] = UTF8_REJECT,
+                      [UTF8_CONT_A0] = UTF8_NEED_1},
+    [UTF8_NEED_ED] = {[0 ... UTF8_CLASSES - 1] = UTF8_REJECT,
+                      [UTF8_CONT_80 ... UTF8_CONT_90] = UTF8_NEED_1},
+    [UTF8_NEED_F0] = {[0 ... UTF8_CLASSES - 1] = UTF8_REJECT,
+                      [UTF8_CONT_90 ... UTF8_CONT_A0] = UTF8_NEED_2},
+    [UTF8_NEED_3] = {[0 ... UTF8_CLASSES - 1] = UTF8_REJECT,
+                     [UTF8_CONT] = UTF8_NEED_2},
+    [UTF8_NEED_F4] = {[0 ... UTF8_CLASSES - 1] = UTF8_REJECT,
+                      [UTF8_CONT_80] = UTF8_NEED_2},
+};
 
-static codepoint_t decode_utf8_codepoint(character_t *buffer, size_t length) {
-  if (!(length > 0 && length <= 3))
-    return 0;
+static uint8_t decode_utf8(uint8_t state, uint32_t *codepoint,
+                           character_t character) {
+  uint8_t class = utf8_class_table[character];
 
-  size_t shift = utf8_codec[0]->bits_stored * (length - 1);
-  codepoint_t codepoint = (*buffer++ & utf8_codec[length]->mask) << shift;
+  if (state == UTF8_ACCEPT)
+    *codepoint = character & utf8_lead_mask_table[class];
+  else
+    *codepoint = (*codepoint << 6) | (character & 0x3f);
 
-  for (size_t i = 1; i < length; ++i, ++buffer) {
-    shift -= utf8_codec[0]->bits_stored;
-    codepoint |= (*buffer & utf8_codec[0]->mask) << shift;
-  }
+  return utf8_transition_table[state][class];
+}
 
-  return codepoint;
+// Codepoints beyond the Basic Multilingual Plane have no glyphs
+static codepoint_t get_utf8_codepoint(uint32_t codepoint) {
+  return codepoint > 0xffff ? REPLACEMENT_CODEPOINT : codepoint;
 }
 
 static codepoint_t transform_codepoint(struct terminal *terminal,
                                        codepoint_t codepoint) {
+  if (codepoint < CHARACTER_DECODER_TABLE_LENGTH)
+    return terminal->charset_map[codepoint];
+
+  return codepoint;
+}
 
-  if (terminal->vs.gset_gl != GSET_UNDEFINED &&
-      terminal->vs.gset_gl <= GSET_MAX &&
-      codepoint < CHARACTER_DECODER_TABLE_LENGTH) {
-    const codepoint_transformation_table_t *table =
-        terminal->vs.gset_table[terminal->vs.gset_gl - 1];
+static codepoint_t single_shift_codepoint(struct terminal *terminal,
+                                          codepoint_t codepoint) {
+  const struct gset_charset *charset =
+      get_gset_charset(terminal, terminal->single_shift);
+  bool gl = codepoint >= 0x20 && codepoint < 0x7f;
+  bool gr = terminal->charset == CHARSET_ISO_8859_1 && codepoint >= 0xa0 &&
+            codepoint < 0xff;
 
-    if (table) {
-      codepoint_t transformed_codepoint = (*table)[codepoint];
-      if (transformed_codepoint)
-        return transformed_codepoint;
-    }
-  }
+  terminal->single_shift = GSET_UNDEFINED;
 
-  if (terminal->charset == CHARSET_IBM_PC) {
-    codepoint_t transformed_codepoint = ibm_pc_table[codepoint];
-    if (transformed_codepoint)
-      return transformed_codepoint;
-  }
+  if (gl || gr)
+    return get_gset_codepoint(charset, codepoint & 0x7f);
 
-  return codepoint;
+  return transform_codepoint(terminal, codepoint);
 }
 
 static void receive_codepoint(struct terminal *terminal,
                               codepoint_t codepoint) {
-  codepoint = transform_codepoint(terminal, codepoint);
+  if (terminal->single_shift)
+    codepoint = single_shift_codepoint(terminal, codepoint);
+  else
+    codepoint = transform_codepoint(terminal, codepoint);
+
   terminal_screen_put_codepoint(terminal, codepoint);
   terminal->prev_codepoint = codepoint;
 }
@@ -1353,121 +1903,744 @@ static void receive_one_byte(struct terminal *terminal, character_t character) {
   receive_codepoint(terminal, (codepoint_t)character);
 }
 
-static const receive_table_t utf8_continuation_receive_table;
+static void clear_utf8_state(struct terminal *terminal) {
+  terminal->utf8_state = UTF8_ACCEPT;
+  terminal->utf8_codepoint = 0;
+}
 
 static void receive_utf8_prefix(struct terminal *terminal,
                                 character_t character) {
-
-  size_t length = get_utf8_codepoint_length(character);
-
-  if (length > 1) {
-    terminal->utf8_codepoint_length = length;
-    terminal->utf8_buffer[terminal->utf8_buffer_length++] = character;
-    terminal->receive_table = &utf8_continuation_receive_table;
-  } else if (length == 1)
-    receive_codepoint(terminal, decode_utf8_codepoint(&character, 1));
-}
-
-static void clear_utf8_buffer(struct terminal *terminal) {
-  terminal->utf8_codepoint_length = 0;
-  terminal->utf8_buffer_length = 0;
-  memset(terminal->utf8_buffer, 0, 4);
+  uint8_t state =
+      decode_utf8(UTF8_ACCEPT, &terminal->utf8_codepoint, character);
+
+  if (state == UTF8_ACCEPT)
+    receive_codepoint(terminal, terminal->utf8_codepoint);
+  else if (state == UTF8_REJECT)
+    receive_codepoint(terminal, REPLACEMENT_CODEPOINT);
+  else {
+    terminal->utf8_state = state;
+    terminal->receive_state = RECEIVE_UTF8;
+  }
 }
 
 static void receive_utf8_continuation(struct terminal *terminal,
                                       character_t character) {
+  uint8_t state = decode_utf8(terminal->utf8_state,
+                              &terminal->utf8_codepoint, character);
 
-  terminal->utf8_buffer[terminal->utf8_buffer_length++] = character;
-  if (terminal->utf8_buffer_length == terminal->utf8_codepoint_length) {
-    receive_codepoint(terminal,
-                      decode_utf8_codepoint(terminal->utf8_buffer,
-                                            terminal->utf8_codepoint_length));
+  if (state == UTF8_ACCEPT || state == UTF8_REJECT) {
+    codepoint_t codepoint = state == UTF8_ACCEPT
+                                ? get_utf8_codepoint(terminal->utf8_codepoint)
+                                : REPLACEMENT_CODEPOINT;
 
-    clear_utf8_buffer(terminal);
-    terminal->receive_table = &utf8_prefix_receive_table;
-  }
+    clear_utf8_state(terminal);
+    terminal->receive_state = RECEIVE_GROUND;
+    receive_codepoint(terminal, codepoint);
+
+    // Character that broke the sequence is received on its own
+    if (state == UTF8_REJECT)
+      terminal_uart_receive_character(terminal, character);
+  } else
+    terminal->utf8_state = state;
 }
 
-static void receive_8bit_control(struct terminal *terminal,
-                                 character_t character,
-                                 character_t control_character) {
-  if (terminal->receive_c1_mode == C1_MODE_7BIT) {
-    receive_t receive = (*terminal->receive_table)[DEFAULT_RECEIVE];
-    receive(terminal, character);
-    return;
-  }
+// C1 controls received as 8-bit characters are handled as ESC sequences
+static const character_t c1_control_table[CHARACTER_DECODER_TABLE_LENGTH] = {
+    [0x84] = 'D', [0x85] = 'E', [0x88] = 'H', [0x8d] = 'M',
+    [0x8e] = 'N', [0x8f] = 'O', [0x90] = 'P', [0x9a] = 'Z',
+    [0x9b] = '[', [0x9d] = ']', [0x9e] = '^', [0x9f] = '_',
+};
 
+static void receive_c1_control(struct terminal *terminal,
+                               character_t character) {
   receive_esc(terminal, 0x1b);
-  terminal_uart_receive_character(terminal, control_character);
+  terminal_uart_receive_character(terminal, c1_control_table[character]);
 }
 
-static void receive_8bit_ind(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, 'D');
+static void receive_unexpected(struct terminal *terminal,
+                               character_t character) {
+#ifdef DEBUG
+  terminal->unhandled = true;
+#endif
+  clear_receive_state(terminal);
 }
 
-static void receive_8bit_nel(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, 'E');
+static void receive_printable(struct terminal *terminal,
+                              character_t character) {
+  if (terminal->charset == CHARSET_UTF8)
+    receive_utf8_prefix(terminal, character);
+  else
+    receive_one_byte(terminal, character);
 }
 
-static void receive_8bit_hts(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, 'H');
-}
+static void receive_control(struct terminal *terminal, character_t character) {
+  switch (character) {
+  case 0x07:
+    receive_bell(terminal, character);
+    break;
 
-static void receive_8bit_ri(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, 'M');
-}
+  case 0x08:
+  case 0x7f:
+    receive_bs(terminal, character);
+    break;
 
-static void receive_8bit_ss2(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, 'N');
-}
+  case 0x09:
+    receive_tab(terminal, character);
+    break;
 
-static void receive_8bit_ss3(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, 'O');
-}
+  case 0x0a:
+  case 0x0b:
+  case 0x0c:
+    receive_lf(terminal, character);
+    break;
 
-static void receive_8bit_dcs(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, 'P');
-}
+  case 0x0d:
+    receive_cr(terminal, character);
+    break;
+
+  case 0x0e:
+    receive_so(terminal, character);
+    break;
 
-static void receive_8bit_da(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, 'Z');
+  case 0x0f:
+    receive_si(terminal, character);
+    break;
+  }
 }
 
-static void receive_8bit_csi(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, '[');
+static void receive_private(struct terminal *terminal, character_t character) {
+  terminal->esc_private = character;
 }
 
-static void receive_8bit_osc(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, ']');
+static void receive_intermediate(struct terminal *terminal,
+                                 character_t character) {
+  // Only sequences with one intermediate are recognized
+  if (terminal->esc_intermediate)
+    terminal->esc_intermediate = CHARACTER_MAX;
+  else
+    terminal->esc_intermediate = character;
 }
 
-static void receive_8bit_pm(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, '^');
+// Final characters run their sequence directly from the receive action
+// rather than through a returned function pointer
+static void receive_esc_final(struct terminal *terminal,
+                              character_t character) {
+  switch (terminal->esc_intermediate) {
+  case 0:
+    switch (character) {
+    case '=':
+      receive_deckpam(terminal, character);
+      return;
+    case '>':
+      receive_deckpnm(terminal, character);
+      return;
+    case 'c':
+      receive_ris(terminal, character);
+      return;
+    case 'n':
+      receive_ls2(terminal, character);
+      return;
+    case 'o':
+      receive_ls3(terminal, character);
+      return;
+    case '|':
+      receive_ls3r(terminal, character);
+      return;
+    case '}':
+      receive_ls2r(terminal, character);
+      return;
+    case '~':
+      receive_ls1r(terminal, character);
+      return;
+    case 'D':
+      receive_ind(terminal, character);
+      return;
+    case 'E':
+      receive_nel(terminal, character);
+      return;
+    case 'H':
+      receive_hts(terminal, character);
+      return;
+    case 'M':
+      receive_ri(terminal, character);
+      return;
+    case 'N':
+      receive_ss2(terminal, character);
+      return;
+    case 'O':
+      receive_ss3(terminal, character);
+      return;
+    case 'Z':
+      receive_da(terminal, character);
+      return;
+    case '7':
+      receive_decsc(terminal, character);
+      return;
+    case '8':
+      receive_decrc(terminal, character);
+      return;
+    }
+    break;
+
+  case '(':
+  case ')':
+  case '*':
+  case '+':
+  case '-':
+  case '.':
+  case '/':
+    receive_scs(terminal, character);
+    return;
+
+  case '#':
+    if (character == '8') {
+      receive_decaln(terminal, character);
+      return;
+    }
+    break;
+
+  case ' ':
+    switch (character) {
+    case 'F':
+      receive_s7c1t(terminal, character);
+      return;
+    case 'G':
+      receive_s8c1t(terminal, character);
+      return;
+    }
+    break;
+
+  case '%':
+    switch (character) {
+    case '@':
+      receive_charset_iso_8859_1(terminal, character);
+      return;
+    case 'G':
+      receive_charset_utf8(terminal, character);
+      return;
+    }
+    break;
+  }
+
+  receive_unexpected(terminal, character);
 }
 
-static void receive_8bit_apc(struct terminal *terminal, character_t character) {
-  receive_8bit_control(terminal, character, '_');
+#define CSI_KEY(private, intermediate) (((private) << 8) | (intermediate))
+
+static void receive_csi_final(struct terminal *terminal,
+                              character_t character) {
+  switch (CSI_KEY(terminal->esc_private, terminal->esc_intermediate)) {
+  case CSI_KEY(0, 0):
+    switch (character) {
+    case '`':
+      receive_hpa(terminal, character);
+      return;
+    case '@':
+      receive_ich(terminal, character);
+      return;
+    case 'a':
+      receive_hpr(terminal, character);
+      return;
+    case 'b':
+      receive_rep(terminal, character);
+      return;
+    case 'c':
+      receive_da(terminal, character);
+      return;
+    case 'd':
+      receive_vpa(terminal, character);
+      return;
+    case 'e':
+      receive_vpr(terminal, character);
+      return;
+    case 'f':
+      receive_hvp(terminal, character);
+      return;
+    case 'g':
+      receive_tbc(terminal, character);
+      return;
+    case 'h':
+      receive_sm(terminal, character);
+      return;
+    case 'l':
+      receive_rm(terminal, character);
+      return;
+    case 'm':
+      receive_sgr(terminal, character);
+      return;
+    case 'n':
+      receive_dsr(terminal, character);
+      return;
+    case 'r':
+      receive_decstbm(terminal, character);
+      return;
+    case 'x':
+      receive_decreqtparm(terminal, character);
+      return;
+    case 'y':
+      receive_dectst(terminal, character);
+      return;
+    case 'A':
+      receive_cuu(terminal, character);
+      return;
+    case 'B':
+      receive_cud(terminal, character);
+      return;
+    case 'C':
+      receive_cuf(terminal, character);
+      return;
+    case 'D':
+      receive_cub(terminal, character);
+      return;
+    case 'E':
+      receive_cnl(terminal, character);
+      return;
+    case 'F':
+      receive_cpl(terminal, character);
+      return;
+    case 'G':
+      receive_cha(terminal, character);
+      return;
+    case 'H':
+      receive_cup(terminal, character);
+      return;
+    case 'I':
+      receive_cht(terminal, character);
+      return;
+    case 'J':
+      receive_ed(terminal, character);
+      return;
+    case 'K':
+      receive_el(terminal, character);
+      return;
+    case 'L':
+      receive_il(terminal, character);
+      return;
+    case 'M':
+      receive_dl(terminal, character);
+      return;
+    case 'P':
+      receive_dch(terminal, character);
+      return;
+    case 'S':
+      receive_su(terminal, character);
+      return;
+    case 'T':
+      receive_sd(terminal, character);
+      return;
+    case 'X':
+      receive_ech(terminal, character);
+      return;
+    case 'Z':
+      receive_cbt(terminal, character);
+      return;
+    }
+    break;
+
+  case CSI_KEY('?', 0):
+    switch (character) {
+    case 'h':
+      receive_decsm(terminal, character);
+      return;
+    case 'l':
+      receive_decrm(terminal, character);
+      return;
+    case 'n':
+      receive_decdsr(terminal, character);
+      return;
+    }
+    break;
+
+  case CSI_KEY('>', 0):
+    if (character == 'c') {
+      receive_sec_da(terminal, character);
+      return;
+    }
+    break;
+
+  case CSI_KEY(0, '!'):
+    if (character == 'p') {
+      receive_decstr(terminal, character);
+      return;
+    }
+    break;
+  }
+
+  receive_unexpected(terminal, character);
 }
 
-static void receive_unexpected(struct terminal *terminal,
+static void receive_vt52_final(struct terminal *terminal,
                                character_t character) {
-#ifdef DEBUG
-  terminal->unhandled = true;
-#endif
-  clear_receive_table(terminal);
+  switch (character) {
+  case 'A':
+    receive_cuu(terminal, character);
+    return;
+  case 'B':
+    receive_cud(terminal, character);
+    return;
+  case 'C':
+    receive_cuf(terminal, character);
+    return;
+  case 'D':
+    receive_cub(terminal, character);
+    return;
+  case 'H':
+    receive_cup(terminal, character);
+    return;
+  case 'I':
+    receive_ri(terminal, character);
+    return;
+  case 'J':
+    receive_ed(terminal, character);
+    return;
+  case 'K':
+    receive_el(terminal, character);
+    return;
+  case 'Y':
+    receive_vt52_move_cursor(terminal, character);
+    return;
+  case 'Z':
+    receive_vt52_id(terminal, character);
+    return;
+  case '=':
+    receive_deckpam(terminal, character);
+    return;
+  case '>':
+    receive_deckpnm(terminal, character);
+    return;
+  case '<':
+    receive_vt52_ansi(terminal, character);
+    return;
+  }
+
+  receive_unexpected(terminal, character);
+}
+
+enum receive_action {
+  ACTION_IGNORE,
+  ACTION_PRINT,
+  ACTION_UTF8,
+  ACTION_CONTROL,
+  ACTION_C1_CONTROL,
+  ACTION_SUB,
+  ACTION_ESC,
+  ACTION_UNEXPECTED,
+  ACTION_PRIVATE,
+  ACTION_INTERMEDIATE,
+  ACTION_PARAM,
+  ACTION_PARAM_DELIMITER,
+  ACTION_ESC_FINAL,
+  ACTION_CSI_FINAL,
+  ACTION_VT52_FINAL,
+  ACTION_VT52_ROW,
+  ACTION_VT52_COL,
+  ACTION_OSC,
+  ACTION_OSC_DATA,
+  ACTION_DCS,
+  ACTION_DCS_DATA,
+  ACTION_APC,
+  ACTION_APC_DATA,
+  ACTION_PM,
+  ACTION_PM_DATA,
+};
+
+static void receive_action(struct terminal *terminal,
+                           enum receive_action action, character_t character) {
+  switch (action) {
+  case ACTION_IGNORE:
+    break;
+
+  case ACTION_PRINT:
+    receive_printable(terminal, character);
+    break;
+
+  case ACTION_UTF8:
+    receive_utf8_continuation(terminal, character);
+    break;
+
+  case ACTION_CONTROL:
+    receive_control(terminal, character);
+    break;
+
+  case ACTION_C1_CONTROL:
+    receive_c1_control(terminal, character);
+    break;
+
+  case ACTION_SUB:
+    receive_sub(terminal, character);
+    break;
+
+  case ACTION_ESC:
+    receive_esc(terminal, character);
+    break;
+
+  case ACTION_UNEXPECTED:
+    receive_unexpected(terminal, character);
+    break;
+
+  case ACTION_PRIVATE:
+    receive_private(terminal, character);
+    break;
+
+  case ACTION_INTERMEDIATE:
+    receive_intermediate(terminal, character);
+    break;
+
+  case ACTION_PARAM:
+    receive_esc_param(terminal, character);
+    break;
+
+  case ACTION_PARAM_DELIMITER:
+    receive_esc_param_delimiter(terminal, character);
+    break;
+
+  case ACTION_ESC_FINAL:
+    receive_esc_final(terminal, character);
+    break;
+
+  case ACTION_CSI_FINAL:
+    receive_csi_final(terminal, character);
+    break;
+
+  case ACTION_VT52_FINAL:
+    receive_vt52_final(terminal, character);
+    break;
+
+  case ACTION_VT52_ROW:
+    receive_vt52_move_cursor_row(terminal, character);
+    break;
+
+  case ACTION_VT52_COL:
+    receive_vt52_move_cursor_col(terminal, character);
+    break;
+
+  case ACTION_OSC:
+    receive_osc(terminal, character);
+    break;
+
+  case ACTION_OSC_DATA:
+    receive_osc_data(terminal, character);
+    break;
+
+  case ACTION_DCS:
+    receive_dcs(terminal, character);
+    break;
+
+  case ACTION_DCS_DATA:
+    receive_dcs_data(terminal, character);
+    break;
+
+  case ACTION_APC:
+    receive_apc(terminal, character);
+    break;
+
+  case ACTION_APC_DATA:
+    receive_apc_data(terminal, character);
+    break;
+
+  case ACTION_PM:
+    receive_pm(terminal, character);
+    break;
+
+  case ACTION_PM_DATA:
+    receive_pm_data(terminal, character);
+    break;
+  }
+}
+
+// Ranges of classes below are used in the transition table
+enum receive_class {
+  CLASS_CONTROL,      // C0 controls without a function
+  CLASS_EXECUTE,      // BEL, BS, HT, LF, VT, FF, CR, SO, SI and DEL
+  CLASS_SUB,          // SUB
+  CLASS_ESC,          // ESC
+  CLASS_C1,           // C1 controls with a function
+  CLASS_HIGH,         // other 0x80-0xff
+  CLASS_INTERMEDIATE, // 0x20-0x2f
+  CLASS_DIGIT,        // 0-9
+  CLASS_COLON,        // :
+  CLASS_SEMICOLON,    // ;
+  CLASS_PRIVATE,      // < = > ?
+  CLASS_CSI,          // [
+  CLASS_OSC,          // ]
+  CLASS_DCS,          // P
+  CLASS_APC,          // _
+  CLASS_PM,           // ^
+  CLASS_FINAL,        // other 0x40-0x7e
+  RECEIVE_CLASSES,
+};
+
+static const uint8_t receive_class_table[CHARACTER_DECODER_TABLE_LENGTH] = {
+    [0x00 ... 0x1f] = CLASS_CONTROL,
+    [0x07 ... 0x0f] = CLASS_EXECUTE,
+    [0x1a] = CLASS_SUB,
+    [0x1b] = CLASS_ESC,
+    [0x20 ... 0x2f] = CLASS_INTERMEDIATE,
+    ['0' ... '9'] = CLASS_DIGIT,
+    [':'] = CLASS_COLON,
+    [';'] = CLASS_SEMICOLON,
+    ['<' ... '?'] = CLASS_PRIVATE,
+    [0x40 ... 0x7e] = CLASS_FINAL,
+    ['['] = CLASS_CSI,
+    [']'] = CLASS_OSC,
+    ['P'] = CLASS_DCS,
+    ['_'] = CLASS_APC,
+    ['^'] = CLASS_PM,
+    [0x7f] = CLASS_EXECUTE,
+    [0x80 ... 0xff] = CLASS_HIGH,
+    [0x84] = CLASS_C1,
+    [0x85] = CLASS_C1,
+    [0x88] = CLASS_C1,
+    [0x8d ... 0x90] = CLASS_C1,
+    [0x9a ... 0x9b] = CLASS_C1,
+    [0x9d ... 0x9f] = CLASS_C1,
+};
+
+#define SAME_STATE RECEIVE_STATES
+
+struct receive_transition {
+  uint8_t action;
+  uint8_t state;
+};
+
+#define TRANSITION(action, state) {ACTION_##action, state}
+
+#define ESCAPE_CONTROLS                                                        \
+  [CLASS_CONTROL] = TRANSITION(UNEXPECTED, SAME_STATE),                        \
+  [CLASS_EXECUTE] = TRANSITION(CONTROL, SAME_STATE),                           \
+  [CLASS_SUB] = TRANSITION(SUB, SAME_STATE),                                   \
+  [CLASS_ESC] = TRANSITION(ESC, SAME_STATE),                                   \
+  [CLASS_C1] = TRANSITION(C1_CONTROL, SAME_STATE),                             \
+  [CLASS_HIGH] = TRANSITION(UNEXPECTED, SAME_STATE)
+
+#define ALL_CLASSES 0 ... RECEIVE_CLASSES - 1
+#define PARAM_CLASSES CLASS_DIGIT ... CLASS_PRIVATE
+#define FINAL_CLASSES CLASS_CSI ... CLASS_FINAL
+
+// Action and next state for every state and class of received character,
+// actions may change the state themselves when the next state is the same
+static const struct receive_transition
+    receive_transition_table[RECEIVE_STATES][RECEIVE_CLASSES] = {
+        [RECEIVE_GROUND] =
+            {
+                [ALL_CLASSES] = TRANSITION(PRINT, SAME_STATE),
+                [CLASS_EXECUTE] = TRANSITION(CONTROL, SAME_STATE),
+                [CLASS_SUB] = TRANSITION(SUB, SAME_STATE),
+                [CLASS_ESC] = TRANSITION(ESC, SAME_STATE),
+                [CLASS_C1] = TRANSITION(C1_CONTROL, SAME_STATE),
+            },
+        [RECEIVE_UTF8] =
+            {
+                [ALL_CLASSES] = TRANSITION(UTF8, SAME_STATE),
+            },
+        [RECEIVE_ESC] =
+            {
+                ESCAPE_CONTROLS,
+                [CLASS_INTERMEDIATE] =
+                    TRANSITION(INTERMEDIATE, RECEIVE_ESC_INTERMEDIATE),
+                [PARAM_CLASSES] = TRANSITION(ESC_FINAL, SAME_STATE),
+                [FINAL_CLASSES] = TRANSITION(ESC_FINAL, SAME_STATE),
+                [CLASS_CSI] = TRANSITION(IGNORE, RECEIVE_CSI),
+                [CLASS_OSC] = TRANSITION(OSC, RECEIVE_OSC),
+                [CLASS_DCS] = TRANSITION(DCS, RECEIVE_DCS),
+                [CLASS_APC] = TRANSITION(APC, RECEIVE_APC),
+                [CLASS_PM] = TRANSITION(PM, RECEIVE_PM),
+            },
+        [RECEIVE_ESC_INTERMEDIATE] =
+            {
+                ESCAPE_CONTROLS,
+                [CLASS_INTERMEDIATE] = TRANSITION(INTERMEDIATE, SAME_STATE),
+                [PARAM_CLASSES] = TRANSITION(ESC_FINAL, SAME_STATE),
+                [FINAL_CLASSES] = TRANSITION(ESC_FINAL, SAME_STATE),
+            },
+        [RECEIVE_CSI] =
+            {
+                ESCAPE_CONTROLS,
+                [CLASS_INTERMEDIATE] =
+                    TRANSITION(INTERMEDIATE, RECEIVE_CSI_INTERMEDIATE),
+                [CLASS_DIGIT] = TRANSITION(PARAM, RECEIVE_CSI_PARAM),
+                [CLASS_COLON] = TRANSITION(PARAM_DELIMITER, RECEIVE_CSI_PARAM),
+                [CLASS_SEMICOLON] =
+                    TRANSITION(PARAM_DELIMITER, RECEIVE_CSI_PARAM),
+                [CLASS_PRIVATE] = TRANSITION(PRIVATE, RECEIVE_CSI_PARAM),
+                [FINAL_CLASSES] = TRANSITION(CSI_FINAL, SAME_STATE),
+            },
+        [RECEIVE_CSI_PARAM] =
+            {
+                ESCAPE_CONTROLS,
+                [CLASS_INTERMEDIATE] =
+                    TRANSITION(INTERMEDIATE, RECEIVE_CSI_INTERMEDIATE),
+                [CLASS_DIGIT] = TRANSITION(PARAM, SAME_STATE),
+                [CLASS_COLON] = TRANSITION(PARAM_DELIMITER, SAME_STATE),
+                [CLASS_SEMICOLON] = TRANSITION(PARAM_DELIMITER, SAME_STATE),
+                [CLASS_PRIVATE] = TRANSITION(IGNORE, RECEIVE_CSI_IGNORE),
+                [FINAL_CLASSES] = TRANSITION(CSI_FINAL, SAME_STATE),
+            },
+        [RECEIVE_CSI_INTERMEDIATE] =
+            {
+                ESCAPE_CONTROLS,
+                [CLASS_INTERMEDIATE] = TRANSITION(INTERMEDIATE, SAME_STATE),
+                [PARAM_CLASSES] = TRANSITION(IGNORE, RECEIVE_CSI_IGNORE),
+                [FINAL_CLASSES] = TRANSITION(CSI_FINAL, SAME_STATE),
+            },
+        [RECEIVE_CSI_IGNORE] =
+            {
+                ESCAPE_CONTROLS,
+                [CLASS_INTERMEDIATE] = TRANSITION(IGNORE, SAME_STATE),
+                [PARAM_CLASSES] = TRANSITION(IGNORE, SAME_STATE),
+                [FINAL_CLASSES] = TRANSITION(UNEXPECTED, SAME_STATE),
+            },
+        [RECEIVE_OSC] =
+            {
+                [ALL_CLASSES] = TRANSITION(OSC_DATA, SAME_STATE),
+            },
+        [RECEIVE_DCS] =
+            {
+                [ALL_CLASSES] = TRANSITION(DCS_DATA, SAME_STATE),
+            },
+        [RECEIVE_APC] =
+            {
+                [ALL_CLASSES] = TRANSITION(APC_DATA, SAME_STATE),
+            },
+        [RECEIVE_PM] =
+            {
+                [ALL_CLASSES] = TRANSITION(PM_DATA, SAME_STATE),
+            },
+        [RECEIVE_VT52_ESC] =
+            {
+                ESCAPE_CONTROLS,
+                [CLASS_INTERMEDIATE] = TRANSITION(VT52_FINAL, SAME_STATE),
+                [PARAM_CLASSES] = TRANSITION(VT52_FINAL, SAME_STATE),
+                [FINAL_CLASSES] = TRANSITION(VT52_FINAL, SAME_STATE),
+            },
+        [RECEIVE_VT52_ROW] =
+            {
+                [ALL_CLASSES] = TRANSITION(VT52_ROW, SAME_STATE),
+            },
+        [RECEIVE_VT52_COL] =
+            {
+                [ALL_CLASSES] = TRANSITION(VT52_COL, SAME_STATE),
+            },
+};
+
+static const struct receive_transition *
+get_receive_transition(struct terminal *terminal, character_t character) {
+  uint8_t class = receive_class_table[character];
+
+  if (class == CLASS_C1 && terminal->receive_c1_mode == C1_MODE_7BIT)
+    class = CLASS_HIGH;
+
+  return &receive_transition_table[terminal->receive_state][class];
 }
 
 void terminal_uart_receive_character(struct terminal *terminal,
                                      character_t character) {
-  receive_t receive = (*terminal->receive_table)[character];
-
-  if (!receive) {
-    receive = (*terminal->receive_table)[DEFAULT_RECEIVE];
-  }
+  const struct receive_transition *transition =
+      get_receive_transition(terminal, character);
 
 #ifdef DEBUG
   // Keep zero for the end of the string for printf
-  if (!codepoint_receive_table(terminal) &&
+  if (!codepoint_receive_state(terminal) &&
       terminal->debug_buffer_length < DEBUG_BUFFER_LENGTH - 1) {
     if (character < 0x20 || (character >= 0x7f && character <= 0xa0))
       terminal->debug_buffer_length += snprintf(
@@ -1481,237 +2654,102 @@ void terminal_uart_receive_character(struct terminal *terminal,
           character);
   }
 #endif
-  receive(terminal, character);
+  receive_action(terminal, transition->action, character);
+
+  if (transition->state != SAME_STATE)
+    terminal->receive_state = transition->state;
 }
 
-void terminal_uart_receive_string(struct terminal *terminal,
-                                  const char *string) {
-  while (*string) {
-    terminal_uart_receive_character(terminal, *string);
-    string++;
-  }
+// True when none of four characters is below 0x20 or above 0x7e
+static bool is_printable_ascii_word(uint32_t word) {
+  return !((((word - 0x20202020) & ~word) | (word + 0x01010101) | word) &
+           0x80808080);
 }
 
-#define RECEIVE_HANDLER(c, h) [c] = h
-#define DEFAULT_RECEIVE_HANDLER(h) [DEFAULT_RECEIVE] = h
-
-#define DEFAULT_RECEIVE_TABLE                                                  \
-  RECEIVE_HANDLER(0x07, receive_bell), RECEIVE_HANDLER(0x08, receive_bs),      \
-      RECEIVE_HANDLER(0x09, receive_tab), RECEIVE_HANDLER(0x0a, receive_lf),   \
-      RECEIVE_HANDLER(0x0b, receive_lf), RECEIVE_HANDLER(0x0c, receive_lf),    \
-      RECEIVE_HANDLER(0x0d, receive_cr), RECEIVE_HANDLER(0x0e, receive_so),    \
-      RECEIVE_HANDLER(0x0f, receive_si), RECEIVE_HANDLER(0x1a, receive_sub),   \
-      RECEIVE_HANDLER(0x1b, receive_esc), RECEIVE_HANDLER(0x7f, receive_bs),   \
-      RECEIVE_HANDLER(0x84, receive_8bit_ind),                                 \
-      RECEIVE_HANDLER(0x85, receive_8bit_nel),                                 \
-      RECEIVE_HANDLER(0x88, receive_8bit_hts),                                 \
-      RECEIVE_HANDLER(0x8d, receive_8bit_ri),                                  \
-      RECEIVE_HANDLER(0x8e, receive_8bit_ss2),                                 \
-      RECEIVE_HANDLER(0x8f, receive_8bit_ss3),                                 \
-      RECEIVE_HANDLER(0x90, receive_8bit_dcs),                                 \
-      RECEIVE_HANDLER(0x9a, receive_8bit_da),                                  \
-      RECEIVE_HANDLER(0x9b, receive_8bit_csi),                                 \
-      RECEIVE_HANDLER(0x9d, receive_8bit_osc),                                 \
-      RECEIVE_HANDLER(0x9e, receive_8bit_pm),                                  \
-      RECEIVE_HANDLER(0x9f, receive_8bit_apc)
-
-static const receive_table_t one_byte_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    DEFAULT_RECEIVE_HANDLER(receive_one_byte),
-};
+static size_t receive_printable_run(struct terminal *terminal,
+                                    const character_t *buffer, size_t size) {
+  if (terminal->receive_state != RECEIVE_GROUND || terminal->single_shift)
+    return 0;
 
-static const receive_table_t utf8_prefix_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    DEFAULT_RECEIVE_HANDLER(receive_utf8_prefix),
-};
+  bool utf8 = terminal->charset == CHARSET_UTF8;
+  codepoint_t codepoints[RECEIVE_RUN_LENGTH];
+  size_t count = 0;
+  size_t i = 0;
 
-static const receive_table_t utf8_continuation_receive_table = {
-    DEFAULT_RECEIVE_HANDLER(receive_utf8_continuation),
-};
+  while (i < size && count < RECEIVE_RUN_LENGTH) {
+    uint32_t word;
 
-static const receive_table_t esc_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    RECEIVE_HANDLER(' ', receive_space),
-    RECEIVE_HANDLER('(', receive_scs),
-    RECEIVE_HANDLER(')', receive_scs),
-    RECEIVE_HANDLER('*', receive_scs),
-    RECEIVE_HANDLER('+', receive_scs),
-    RECEIVE_HANDLER('-', receive_scs),
-    RECEIVE_HANDLER('.', receive_scs),
-    RECEIVE_HANDLER('/', receive_scs),
-    RECEIVE_HANDLER('[', receive_csi),
-    RECEIVE_HANDLER(']', receive_osc),
-    RECEIVE_HANDLER('#', receive_hash),
-    RECEIVE_HANDLER('=', receive_deckpam),
-    RECEIVE_HANDLER('>', receive_deckpnm),
-    RECEIVE_HANDLER('_', receive_apc),
-    RECEIVE_HANDLER('^', receive_pm),
-    RECEIVE_HANDLER('%', receive_percent),
-    RECEIVE_HANDLER('c', receive_ris),
-    RECEIVE_HANDLER('n', receive_ls2),
-    RECEIVE_HANDLER('o', receive_ls3),
-    RECEIVE_HANDLER('E', receive_nel),
-    RECEIVE_HANDLER('D', receive_ind),
-    RECEIVE_HANDLER('H', receive_hts),
-    RECEIVE_HANDLER('M', receive_ri),
-    RECEIVE_HANDLER('N', receive_ss2),
-    RECEIVE_HANDLER('O', receive_ss3),
-    RECEIVE_HANDLER('P', receive_dcs),
-    RECEIVE_HANDLER('Z', receive_da),
-    RECEIVE_HANDLER('7', receive_decsc),
-    RECEIVE_HANDLER('8', receive_decrc),
-    DEFAULT_RECEIVE_HANDLER(receive_unexpected),
-};
+    // Printable ASCII is taken a word at a time
+    if (i + 4 <= size && count + 4 <= RECEIVE_RUN_LENGTH) {
+      memcpy(&word, buffer + i, 4);
 
-static const receive_table_t vt52_esc_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    RECEIVE_HANDLER('A', receive_cuu),
-    RECEIVE_HANDLER('B', receive_cud),
-    RECEIVE_HANDLER('C', receive_cuf),
-    RECEIVE_HANDLER('D', receive_cub),
-    RECEIVE_HANDLER('H', receive_cup),
-    RECEIVE_HANDLER('I', receive_ri),
-    RECEIVE_HANDLER('J', receive_ed),
-    RECEIVE_HANDLER('K', receive_el),
-    RECEIVE_HANDLER('Y', receive_vt52_move_cursor),
-    RECEIVE_HANDLER('Z', receive_vt52_id),
-    RECEIVE_HANDLER('=', receive_deckpam),
-    RECEIVE_HANDLER('>', receive_deckpnm),
-    RECEIVE_HANDLER('<', receive_vt52_ansi),
-    DEFAULT_RECEIVE_HANDLER(receive_unexpected),
-};
+      if (is_printable_ascii_word(word)) {
+        for (size_t k = 0; k < 4; ++k)
+          codepoints[count++] = terminal->charset_map[buffer[i + k]];
 
-static const receive_table_t vt52_move_cursor_row_receive_table = {
-    DEFAULT_RECEIVE_HANDLER(receive_vt52_move_cursor_row),
-};
+        i += 4;
+        continue;
+      }
+    }
 
-static const receive_table_t vt52_move_cursor_col_receive_table = {
-    DEFAULT_RECEIVE_HANDLER(receive_vt52_move_cursor_col),
-};
+    character_t character = buffer[i];
+    uint8_t class = receive_class_table[character];
 
-#define ESC_PARAM_RECEIVE_TABLE                                                \
-  RECEIVE_HANDLER('0', receive_esc_param),                                     \
-      RECEIVE_HANDLER('1', receive_esc_param),                                 \
-      RECEIVE_HANDLER('2', receive_esc_param),                                 \
-      RECEIVE_HANDLER('3', receive_esc_param),                                 \
-      RECEIVE_HANDLER('4', receive_esc_param),                                 \
-      RECEIVE_HANDLER('5', receive_esc_param),                                 \
-      RECEIVE_HANDLER('6', receive_esc_param),                                 \
-      RECEIVE_HANDLER('7', receive_esc_param),                                 \
-      RECEIVE_HANDLER('8', receive_esc_param),                                 \
-      RECEIVE_HANDLER('9', receive_esc_param),                                 \
-      RECEIVE_HANDLER(';', receive_esc_param_delimiter)
-
-static const receive_table_t csi_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    ESC_PARAM_RECEIVE_TABLE,
-    RECEIVE_HANDLER('`', receive_hpa),
-    RECEIVE_HANDLER('@', receive_ich),
-    RECEIVE_HANDLER('?', receive_csi_qm),
-    RECEIVE_HANDLER('!', receive_csi_em),
-    RECEIVE_HANDLER('>', receive_csi_gt),
-    RECEIVE_HANDLER('a', receive_hpr),
-    RECEIVE_HANDLER('b', receive_rep),
-    RECEIVE_HANDLER('c', receive_da),
-    RECEIVE_HANDLER('d', receive_vpa),
-    RECEIVE_HANDLER('e', receive_vpr),
-    RECEIVE_HANDLER('f', receive_hvp),
-    RECEIVE_HANDLER('g', receive_tbc),
-    RECEIVE_HANDLER('h', receive_sm),
-    RECEIVE_HANDLER('l', receive_rm),
-    RECEIVE_HANDLER('m', receive_sgr),
-    RECEIVE_HANDLER('n', receive_dsr),
-    RECEIVE_HANDLER('r', receive_decstbm),
-    RECEIVE_HANDLER('x', receive_decreqtparm),
-    RECEIVE_HANDLER('y', receive_dectst),
-    RECEIVE_HANDLER('A', receive_cuu),
-    RECEIVE_HANDLER('B', receive_cud),
-    RECEIVE_HANDLER('C', receive_cuf),
-    RECEIVE_HANDLER('D', receive_cub),
-    RECEIVE_HANDLER('E', receive_cnl),
-    RECEIVE_HANDLER('F', receive_cpl),
-    RECEIVE_HANDLER('G', receive_cha),
-    RECEIVE_HANDLER('H', receive_cup),
-    RECEIVE_HANDLER('I', receive_cht),
-    RECEIVE_HANDLER('J', receive_ed),
-    RECEIVE_HANDLER('K', receive_el),
-    RECEIVE_HANDLER('L', receive_il),
-    RECEIVE_HANDLER('M', receive_dl),
-    RECEIVE_HANDLER('P', receive_dch),
-    RECEIVE_HANDLER('S', receive_su),
-    RECEIVE_HANDLER('T', receive_sd),
-    RECEIVE_HANDLER('X', receive_ech),
-    RECEIVE_HANDLER('Z', receive_cbt),
-    DEFAULT_RECEIVE_HANDLER(receive_unexpected),
-};
+    if (receive_transition_table[RECEIVE_GROUND][class].action != ACTION_PRINT)
+      break;
 
-static const receive_table_t csi_qm_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    ESC_PARAM_RECEIVE_TABLE,
-    RECEIVE_HANDLER('h', receive_decsm),
-    RECEIVE_HANDLER('l', receive_decrm),
-    DEFAULT_RECEIVE_HANDLER(receive_unexpected),
-};
+    if (utf8 && character >= 0x80) {
+      uint8_t state = UTF8_ACCEPT;
+      uint32_t codepoint;
+      size_t length = 0;
 
-static const receive_table_t csi_em_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    ESC_PARAM_RECEIVE_TABLE,
-    RECEIVE_HANDLER('p', receive_decstr),
-    DEFAULT_RECEIVE_HANDLER(receive_unexpected),
-};
+      do
+        state = decode_utf8(state, &codepoint, buffer[i + length++]);
+      while (state != UTF8_ACCEPT && state != UTF8_REJECT && i + length < size);
 
-static const receive_table_t csi_gt_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    ESC_PARAM_RECEIVE_TABLE,
-    RECEIVE_HANDLER('c', receive_sec_da),
-    DEFAULT_RECEIVE_HANDLER(receive_unexpected),
-};
+      // Invalid and incomplete sequences are received one character at a time
+      if (state != UTF8_ACCEPT)
+        break;
 
-static const receive_table_t esc_hash_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    RECEIVE_HANDLER('8', receive_decaln),
-    DEFAULT_RECEIVE_HANDLER(receive_unexpected),
-};
+      codepoints[count++] =
+          transform_codepoint(terminal, get_utf8_codepoint(codepoint));
+      i += length;
+    } else
+      codepoints[count++] = terminal->charset_map[buffer[i++]];
+  }
 
-static const receive_table_t esc_space_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    RECEIVE_HANDLER('F', receive_s7c1t),
-    RECEIVE_HANDLER('G', receive_s8c1t),
-    DEFAULT_RECEIVE_HANDLER(receive_unexpected),
-};
+  if (count) {
+    terminal_screen_put_codepoints(terminal, codepoints, count);
+    terminal->prev_codepoint = codepoints[count - 1];
+  }
 
-static const receive_table_t scs_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    RECEIVE_HANDLER('A', receive_scs_set),
-    RECEIVE_HANDLER('B', receive_scs_set),
-    RECEIVE_HANDLER('0', receive_scs_set),
-    RECEIVE_HANDLER('1', receive_scs_set),
-    RECEIVE_HANDLER('2', receive_scs_set),
-    DEFAULT_RECEIVE_HANDLER(receive_unexpected),
-};
+  return i;
+}
 
-static const receive_table_t esc_percent_receive_table = {
-    DEFAULT_RECEIVE_TABLE,
-    RECEIVE_HANDLER('@', receive_charset_iso_8859_1),
-    RECEIVE_HANDLER('G', receive_charset_utf8),
-    DEFAULT_RECEIVE_HANDLER(receive_unexpected),
-};
+void terminal_uart_receive_buffer(struct terminal *terminal,
+                                  const character_t *buffer, size_t size) {
+  PROFILE_BEGIN(PROFILE_PARSER);
 
-static const receive_table_t dcs_receive_table = {
-    DEFAULT_RECEIVE_HANDLER(receive_dcs_data),
-};
+  while (size) {
+    size_t length = receive_printable_run(terminal, buffer, size);
 
-static const receive_table_t osc_receive_table = {
-    DEFAULT_RECEIVE_HANDLER(receive_osc_data),
-};
+    if (!length) {
+      terminal_uart_receive_character(terminal, *buffer);
+      length = 1;
+    }
 
-static const receive_table_t apc_receive_table = {
-    DEFAULT_RECEIVE_HANDLER(receive_apc_data),
-};
+    buffer += length;
+    size -= length;
+  }
 
-static const receive_table_t pm_receive_table = {
-    DEFAULT_RECEIVE_HANDLER(receive_pm_data),
-};
+  PROFILE_END(PROFILE_PARSER);
+}
+
+void terminal_uart_receive_string(struct terminal *terminal,
+                                  const char *string) {
+  terminal_uart_receive_buffer(terminal, (const character_t *)string,
+                               strlen(string));
+}
 
 void terminal_uart_transmit_character(struct terminal *terminal,
                                       character_t character) {
@@ -1806,6 +2844,11 @@ void terminal_uart_xon_off(struct terminal *terminal, enum xon_off xon_off) {
 
 void terminal_uart_flow_control(struct terminal *terminal,
                                 size_t receive_size) {
+  PROFILE_BEGIN(PROFILE_FLOW_CONTROL);
+
+  if (receive_size > terminal->link_statistics.peak_fill)
+    terminal->link_statistics.peak_fill = receive_size;
+
   if (terminal->flow_control) {
     if (receive_size > XOFF_LIMIT)
       terminal_uart_xon_off(terminal, XOFF);
@@ -1813,16 +2856,20 @@ void terminal_uart_flow_control(struct terminal *terminal,
     if (receive_size < XON_LIMIT)
       terminal_uart_xon_off(terminal, XON);
   }
+
+  PROFILE_END(PROFILE_FLOW_CONTROL);
+}
+
+void terminal_uart_update_xoff_counter(struct terminal *terminal) {
+  if (terminal->xon_off == XOFF)
+    terminal->link_statistics.xoff_time++;
 }
 
 void terminal_uart_init(struct terminal *terminal) {
-  if (terminal->charset == CHARSET_UTF8)
-    terminal->receive_table = &utf8_prefix_receive_table;
-  else
-    terminal->receive_table = &one_byte_receive_table;
+  terminal->receive_state = RECEIVE_GROUND;
 
   clear_esc_params(terminal);
-  clear_utf8_buffer(terminal);
+  clear_utf8_state(terminal);
   clear_control_data(&terminal->dcs);
   clear_control_data(&terminal->osc);
   clear_control_data(&terminal->apc);
@@ -1830,12 +2877,15 @@ void terminal_uart_init(struct terminal *terminal) {
 
   terminal->prev_codepoint = 0;
 
-  terminal->gset_received = GSET_UNDEFINED;
   terminal->xon_off = XON;
+  memset(&terminal->link_statistics, 0, sizeof(struct link_statistics));
 
   terminal->vs.gset_gl = GSET_G0;
-  memset(terminal->vs.gset_table, 0,
-         GSET_MAX * sizeof(codepoint_transformation_table_t *));
+  terminal->vs.gset_gr = GSET_UNDEFINED;
+  for (size_t i = 0; i < GSET_MAX; ++i)
+    terminal->vs.gset_charset[i] = &ascii_charset;
+  terminal->single_shift = GSET_UNDEFINED;
+  update_charset_map(terminal);
 
 #ifdef DEBUG
   memset(terminal->debug_buffer, 0, DEBUG_BUFFER_LENGTH);